@@ -0,0 +1,74 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/constrained_type.hpp>
+
+#include "bench_framework.hpp"
+
+namespace
+{
+using ts_bench::do_not_optimize;
+using ts_bench::state;
+
+constexpr auto no_elements = 1024;
+
+// baseline: the bounds check written by hand
+void constrained_raw(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            auto value = i % 100;
+            if (value < 0 || value > 100)
+                break;
+            sum += value;
+        }
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(constrained_raw);
+
+void constrained_assertion_verifier(state& s)
+{
+    using bounded = type_safe::bounded_type<int, true, true, std::integral_constant<int, 0>,
+                                            std::integral_constant<int, 100>>;
+
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            bounded value(i % 100);
+            sum += value.get_value();
+        }
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(constrained_assertion_verifier);
+
+void constrained_throwing_verifier(state& s)
+{
+    using bounded
+        = type_safe::bounded_type<int, true, true, std::integral_constant<int, 0>,
+                                  std::integral_constant<int, 100>, type_safe::throwing_verifier>;
+
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            bounded value(i % 100);
+            sum += value.get_value();
+        }
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(constrained_throwing_verifier);
+} // namespace
@@ -0,0 +1,77 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/flag_set.hpp>
+
+#include "bench_framework.hpp"
+
+namespace
+{
+using ts_bench::do_not_optimize;
+using ts_bench::state;
+
+constexpr auto no_elements = 1024;
+
+enum class process_flags
+{
+    running,
+    waiting,
+    traced,
+    detached,
+    _flag_set_size,
+};
+
+// baseline: the same operations on a raw unsigned
+void flag_set_raw(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto set = 0u;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            set |= 1u << (i % 4);
+            set &= ~(1u << ((i + 2) % 4));
+            set ^= 1u << ((i + 1) % 4);
+        }
+        do_not_optimize(set);
+    }
+}
+BENCHMARK(flag_set_raw);
+
+void flag_set_ops(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        type_safe::flag_set<process_flags> set;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            set |= process_flags(i % 4);
+            set &= ~process_flags((i + 2) % 4);
+            set ^= process_flags((i + 1) % 4);
+        }
+        do_not_optimize(set);
+    }
+}
+BENCHMARK(flag_set_ops);
+
+void flag_set_iteration(state& s)
+{
+    type_safe::flag_set<process_flags> set;
+    set |= process_flags::running;
+    set |= process_flags::traced;
+
+    for (auto _ : s)
+    {
+        (void)_;
+        auto count = 0;
+        for (auto i = 0; i != no_elements; ++i)
+            for (auto flag : set)
+                count += int(flag);
+        do_not_optimize(count);
+    }
+}
+BENCHMARK(flag_set_iteration);
+} // namespace
@@ -0,0 +1,227 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BENCH_FRAMEWORK_HPP_INCLUDED
+#define TYPE_SAFE_BENCH_FRAMEWORK_HPP_INCLUDED
+
+// A minimal, dependency-free microbenchmark harness.
+//
+// The API mirrors the subset of Google Benchmark the suite uses
+// (`BENCHMARK()`, `for (auto _ : state)`, `do_not_optimize()`),
+// and `--benchmark_out=<file>` writes results in the Google Benchmark JSON layout,
+// so the usual comparison tooling can diff two runs.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ts_bench
+{
+/// Prevents the compiler from optimizing away a computed value.
+template <typename T>
+inline void do_not_optimize(T&& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// Prevents the compiler from reordering memory operations across the call.
+inline void clobber_memory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+/// The state of a single benchmark run.
+///
+/// Iterating it runs the benchmark body until enough time was measured,
+/// like Google Benchmark's `State`.
+class state
+{
+public:
+    class iterator
+    {
+    public:
+        int operator*() const noexcept
+        {
+            return 0;
+        }
+
+        iterator& operator++() noexcept
+        {
+            --remaining_;
+            return *this;
+        }
+
+        bool operator!=(const iterator& other) const noexcept
+        {
+            return remaining_ != other.remaining_;
+        }
+
+    private:
+        explicit iterator(std::uint64_t remaining) noexcept : remaining_(remaining) {}
+
+        std::uint64_t remaining_;
+
+        friend state;
+    };
+
+    explicit state(std::uint64_t iterations) noexcept : iterations_(iterations) {}
+
+    iterator begin() noexcept
+    {
+        start_ = clock::now();
+        return iterator(iterations_);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(0u);
+    }
+
+    std::uint64_t iterations() const noexcept
+    {
+        return iterations_;
+    }
+
+    /// \returns The measured time of the whole loop in nanoseconds.
+    double elapsed() const noexcept
+    {
+        return std::chrono::duration<double, std::nano>(clock::now() - start_).count();
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    std::uint64_t     iterations_;
+    clock::time_point start_;
+};
+
+using benchmark_function = void (*)(state&);
+
+struct benchmark
+{
+    const char*        name;
+    benchmark_function function;
+};
+
+inline std::vector<benchmark>& registry()
+{
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct registrar
+{
+    registrar(const char* name, benchmark_function function)
+    {
+        registry().push_back(benchmark{name, function});
+    }
+};
+
+struct result
+{
+    std::string   name;
+    std::uint64_t iterations;
+    double        ns_per_iteration;
+};
+
+/// Runs one benchmark, scaling the iteration count until the run is long enough
+/// for the timer resolution not to matter.
+inline result run(const benchmark& b)
+{
+    constexpr auto min_time_ns = 50e6; // 50ms measured time per benchmark
+
+    auto iterations = std::uint64_t(1);
+    for (;;)
+    {
+        state s(iterations);
+        b.function(s);
+        auto elapsed = s.elapsed();
+
+        if (elapsed >= min_time_ns)
+            return result{b.name, iterations, elapsed / double(iterations)};
+        else if (elapsed <= 0.)
+            iterations *= 10u;
+        else
+        {
+            // overshoot the target slightly so the next run is the last
+            auto scaled = std::uint64_t(double(iterations) * min_time_ns / elapsed * 1.2);
+            iterations  = scaled > iterations ? scaled : iterations * 2u;
+        }
+    }
+}
+
+inline void write_json(std::ostream& out, const std::vector<result>& results)
+{
+    out << "{\n";
+    out << "  \"context\": {\"library\": \"type_safe\"},\n";
+    out << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0u; i != results.size(); ++i)
+    {
+        const auto& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"run_type\": \"iteration\", "
+            << "\"iterations\": " << r.iterations << ", "
+            << "\"real_time\": " << r.ns_per_iteration << ", "
+            << "\"cpu_time\": " << r.ns_per_iteration << ", "
+            << "\"time_unit\": \"ns\"}" << (i + 1u == results.size() ? "\n" : ",\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+inline int main(int argc, char* argv[])
+{
+    std::string out_file;
+    std::string filter;
+    for (auto i = 1; i != argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--benchmark_out=", 16u) == 0)
+            out_file = argv[i] + 16u;
+        else if (std::strncmp(argv[i], "--benchmark_filter=", 19u) == 0)
+            filter = argv[i] + 19u;
+    }
+
+    std::vector<result> results;
+    for (const auto& b : registry())
+    {
+        if (!filter.empty() && std::string(b.name).find(filter) == std::string::npos)
+            continue;
+
+        auto r = run(b);
+        std::cout << r.name << ": " << r.ns_per_iteration << " ns/iter (" << r.iterations
+                  << " iterations)\n";
+        results.push_back(r);
+    }
+
+    if (!out_file.empty())
+    {
+        std::ofstream file(out_file.c_str());
+        if (!file.is_open())
+        {
+            std::cerr << "could not open benchmark output file: " << out_file << '\n';
+            return 1;
+        }
+        write_json(file, results);
+    }
+
+    return 0;
+}
+} // namespace ts_bench
+
+/// Registers a benchmark function, like Google Benchmark's macro of the same name.
+#define BENCHMARK(Function)                                                                        \
+    static ts_bench::registrar ts_bench_registrar_##Function(#Function, &Function)
+
+#endif // TYPE_SAFE_BENCH_FRAMEWORK_HPP_INCLUDED
@@ -0,0 +1,57 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/integer.hpp>
+
+#include "bench_framework.hpp"
+
+namespace
+{
+using ts_bench::do_not_optimize;
+using ts_bench::state;
+
+constexpr auto no_elements = 1024;
+
+// baseline: the same mixed arithmetic on raw int
+void integer_raw(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 1; i != no_elements; ++i)
+            sum += i * 2 - i / 2;
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(integer_raw);
+
+void integer_default_policy(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = type_safe::integer<int>(0);
+        for (auto i = type_safe::integer<int>(1); i != no_elements; ++i)
+            sum += i * 2 - i / 2;
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(integer_default_policy);
+
+void integer_undefined_behavior_policy(state& s)
+{
+    using integer = type_safe::integer<int, type_safe::undefined_behavior_arithmetic>;
+
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = integer(0);
+        for (auto i = integer(1); i != no_elements; ++i)
+            sum += i * 2 - i / 2;
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(integer_undefined_behavior_policy);
+} // namespace
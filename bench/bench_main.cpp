@@ -0,0 +1,10 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include "bench_framework.hpp"
+
+int main(int argc, char* argv[])
+{
+    return ts_bench::main(argc, argv);
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/optional.hpp>
+
+#include "bench_framework.hpp"
+
+namespace
+{
+using ts_bench::do_not_optimize;
+using ts_bench::state;
+
+constexpr auto no_elements = 1024;
+
+// baseline: the map chain written by hand with branches
+void optional_map_chain_raw(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            auto present = i % 2 == 0;
+            if (present)
+            {
+                auto value = i * 2;
+                value += 1;
+                sum += value;
+            }
+        }
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(optional_map_chain_raw);
+
+void optional_map_chain(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        auto sum = 0;
+        for (auto i = 0; i != no_elements; ++i)
+        {
+            type_safe::optional<int> opt;
+            if (i % 2 == 0)
+                opt = i;
+
+            sum += opt.map([](int value) { return value * 2; })
+                       .map([](int value) { return value + 1; })
+                       .value_or(0);
+        }
+        do_not_optimize(sum);
+    }
+}
+BENCHMARK(optional_map_chain);
+
+void optional_assignment(state& s)
+{
+    for (auto _ : s)
+    {
+        (void)_;
+        type_safe::optional<int> opt;
+        for (auto i = 0; i != no_elements; ++i)
+            opt = i;
+        do_not_optimize(opt);
+    }
+}
+BENCHMARK(optional_assignment);
+} // namespace
@@ -0,0 +1,85 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/variant.hpp>
+#include <type_safe/visitor.hpp>
+
+#include <vector>
+
+#include "bench_framework.hpp"
+
+namespace
+{
+using ts_bench::do_not_optimize;
+using ts_bench::state;
+
+constexpr auto no_elements = 1024;
+
+using variant = type_safe::variant<int, float, bool>;
+
+std::vector<variant> make_mixed_variants()
+{
+    std::vector<variant> variants;
+    variants.reserve(no_elements);
+    for (auto i = 0; i != no_elements; ++i)
+    {
+        if (i % 3 == 0)
+            variants.push_back(variant(i));
+        else if (i % 3 == 1)
+            variants.push_back(variant(float(i)));
+        else
+            variants.push_back(variant(i % 2 == 0));
+    }
+    return variants;
+}
+
+struct sum_visitor
+{
+    int sum = 0;
+
+    void operator()(int i)
+    {
+        sum += i;
+    }
+
+    void operator()(float f)
+    {
+        sum += int(f);
+    }
+
+    void operator()(bool b)
+    {
+        sum += b ? 1 : 0;
+    }
+};
+
+// baseline: per-element dispatch on a mixed stream
+void variant_visit(state& s)
+{
+    auto variants = make_mixed_variants();
+    for (auto _ : s)
+    {
+        (void)_;
+        sum_visitor visitor;
+        for (auto& var : variants)
+            type_safe::visit(visitor, var);
+        do_not_optimize(visitor.sum);
+    }
+}
+BENCHMARK(variant_visit);
+
+// grouped by discriminant, one dispatch per type
+void variant_visit_all(state& s)
+{
+    auto variants = make_mixed_variants();
+    for (auto _ : s)
+    {
+        (void)_;
+        sum_visitor visitor;
+        type_safe::visit_all(variants.begin(), variants.end(), visitor);
+        do_not_optimize(visitor.sum);
+    }
+}
+BENCHMARK(variant_visit_all);
+} // namespace
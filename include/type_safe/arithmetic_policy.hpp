@@ -69,6 +69,30 @@ namespace detail
         typename std::conditional<std::is_signed<T>::value, signed_integer_tag,
                                   unsigned_integer_tag>::type;
 
+#if TYPE_SAFE_USE_OVERFLOW_BUILTINS
+    // The builtins handle signed and unsigned types alike,
+    // so both tags share the same implementation.
+    template <typename Tag, typename T>
+    constexpr bool will_addition_error(Tag, T a, T b)
+    {
+        T result{};
+        return __builtin_add_overflow(a, b, &result);
+    }
+
+    template <typename Tag, typename T>
+    constexpr bool will_subtraction_error(Tag, T a, T b)
+    {
+        T result{};
+        return __builtin_sub_overflow(a, b, &result);
+    }
+
+    template <typename Tag, typename T>
+    constexpr bool will_multiplication_error(Tag, T a, T b)
+    {
+        T result{};
+        return __builtin_mul_overflow(a, b, &result);
+    }
+#else
     template <typename T>
     constexpr bool will_addition_error(signed_integer_tag, T a, T b)
     {
@@ -107,6 +131,7 @@ namespace detail
     {
         return b != T(0) && a > std::numeric_limits<T>::max() / b;
     }
+#endif
 
     template <typename T>
     constexpr bool will_division_error(signed_integer_tag, T a, T b)
@@ -129,6 +154,42 @@ namespace detail
     {
         return b == T(0);
     }
+
+    // The value an operation saturates to is derived from the operand signs alone,
+    // so the compiler can turn the selection into a conditional move.
+    template <typename T>
+    constexpr T saturated_addition(signed_integer_tag, T, T b)
+    {
+        return b > T(0) ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+    }
+    template <typename T>
+    constexpr T saturated_addition(unsigned_integer_tag, T, T)
+    {
+        return std::numeric_limits<T>::max();
+    }
+
+    template <typename T>
+    constexpr T saturated_subtraction(signed_integer_tag, T, T b)
+    {
+        return b > T(0) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    }
+    template <typename T>
+    constexpr T saturated_subtraction(unsigned_integer_tag, T, T)
+    {
+        return T(0);
+    }
+
+    template <typename T>
+    constexpr T saturated_multiplication(signed_integer_tag, T a, T b)
+    {
+        return (a < T(0)) != (b < T(0)) ? std::numeric_limits<T>::min()
+                                        : std::numeric_limits<T>::max();
+    }
+    template <typename T>
+    constexpr T saturated_multiplication(unsigned_integer_tag, T, T)
+    {
+        return std::numeric_limits<T>::max();
+    }
 } // namespace detail
 
 /// An `ArithmeticPolicy` where under/overflow is always undefined behavior,
@@ -140,7 +201,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(T a, T b) noexcept
     {
-        return detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b))
                    ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
                                        "addition will result in overflow")
                    : T(a + b);
@@ -149,7 +210,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(T a, T b) noexcept
     {
-        return detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b))
                    ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
                                        "subtraction will result in underflow")
                    : T(a - b);
@@ -158,7 +219,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(T a, T b) noexcept
     {
-        return detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b))
                    ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
                                        "multiplication will result in overflow")
                    : T(a * b);
@@ -167,7 +228,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_division(T a, T b) noexcept
     {
-        return detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b))
                    ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
                                        "division by zero/overflow")
                    : T(a / b);
@@ -176,7 +237,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(T a, T b) noexcept
     {
-        return detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b))
                    ? DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "modulo by zero")
                    : T(a % b);
     }
@@ -203,7 +264,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(T a, T b)
     {
-        return detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b))
                ? TYPE_SAFE_THROW(error("addition will result in overflow")),
                a : a + b;
     }
@@ -211,7 +272,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(T a, T b)
     {
-        return detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b))
                ? TYPE_SAFE_THROW(error("subtraction will result in underflow")),
                a : a - b;
     }
@@ -219,7 +280,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(T a, T b)
     {
-        return detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b))
                ? TYPE_SAFE_THROW(error("multiplication will result in overflow")),
                a : a * b;
     }
@@ -227,7 +288,7 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_division(T a, T b)
     {
-        return detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b))
                ? TYPE_SAFE_THROW(error("division by zero/overflow")),
                a : a / b;
     }
@@ -235,12 +296,186 @@ public:
     template <typename T>
     TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(T a, T b)
     {
-        return detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b)
+        return TYPE_SAFE_UNLIKELY(detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b))
                ? TYPE_SAFE_THROW(error("modulo by zero")),
                a : a % b;
     }
 };
 
+/// An `ArithmeticPolicy` where under/overflow wraps around modulo `2^n`,
+/// also for signed types.
+///
+/// The operations are performed on the unsigned counterpart and cast back,
+/// which is a no-op on two's complement targets,
+/// so the policy produces the same code as the raw integer type.
+/// This is meant for hash and checksum style code that relies on wrap around
+/// but wants to keep strong typing.
+/// Division by zero and modulo by zero remain preconditions,
+/// they have no wrap around semantics.
+/// \notes The conversion back to the signed type is implementation-defined
+/// before C++20, but all supported implementations use two's complement.
+/// \module types
+class wrapping_arithmetic
+{
+public:
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(T a, T b) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        return static_cast<T>(
+            static_cast<unsigned_type>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b)));
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(T a, T b) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        return static_cast<T>(
+            static_cast<unsigned_type>(static_cast<unsigned_type>(a) - static_cast<unsigned_type>(b)));
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(T a, T b) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+        return static_cast<T>(
+            static_cast<unsigned_type>(static_cast<unsigned_type>(a) * static_cast<unsigned_type>(b)));
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_division(T a, T b) noexcept
+    {
+        // the only overflowing division, min / -1, wraps around to min again
+        return TYPE_SAFE_UNLIKELY(b == T(0))
+                   ? DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "division by zero")
+                   : std::is_signed<T>::value && b == T(-1) ? do_multiplication(a, T(-1))
+                                                            : T(a / b);
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(T a, T b) noexcept
+    {
+        return TYPE_SAFE_UNLIKELY(b == T(0))
+                   ? DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "modulo by zero")
+                   : std::is_signed<T>::value && b == T(-1) ? T(0) : T(a % b);
+    }
+};
+
+/// An `ArithmeticPolicy` where under/overflow clamps to the minimum/maximum value
+/// of the type instead.
+///
+/// The saturation value only depends on the operand signs,
+/// so together with [TYPE_SAFE_USE_OVERFLOW_BUILTINS]() the operations compile
+/// to an overflow check plus a conditional move, without branches.
+/// Division by zero and modulo by zero remain preconditions,
+/// they are not a saturating operation.
+/// \module types
+class saturating_arithmetic
+{
+public:
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_addition(T a, T b) noexcept
+    {
+        return detail::will_addition_error(detail::arithmetic_tag_for<T>{}, a, b)
+                   ? detail::saturated_addition(detail::arithmetic_tag_for<T>{}, a, b)
+                   : T(a + b);
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_subtraction(T a, T b) noexcept
+    {
+        return detail::will_subtraction_error(detail::arithmetic_tag_for<T>{}, a, b)
+                   ? detail::saturated_subtraction(detail::arithmetic_tag_for<T>{}, a, b)
+                   : T(a - b);
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_multiplication(T a, T b) noexcept
+    {
+        return detail::will_multiplication_error(detail::arithmetic_tag_for<T>{}, a, b)
+                   ? detail::saturated_multiplication(detail::arithmetic_tag_for<T>{}, a, b)
+                   : T(a * b);
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_division(T a, T b) noexcept
+    {
+        // the only overflowing division, min / -1, saturates to max
+        return std::is_signed<T>::value && b == T(-1) && a == std::numeric_limits<T>::min()
+                   ? std::numeric_limits<T>::max()
+                   : detail::will_division_error(detail::arithmetic_tag_for<T>{}, a, b)
+                         ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
+                                             "division by zero")
+                         : T(a / b);
+    }
+
+    template <typename T>
+    TYPE_SAFE_FORCE_INLINE static constexpr T do_modulo(T a, T b) noexcept
+    {
+        return detail::will_modulo_error(detail::arithmetic_tag_for<T>{}, a, b)
+                   ? DEBUG_UNREACHABLE(detail::precondition_error_handler{}, "modulo by zero")
+                   : T(a % b);
+    }
+};
+
+/// Tag type to mark an [ts::arith_result]() that is in the error state.
+/// \module types
+struct arith_error
+{};
+
+/// The result of a non-throwing checked arithmetic operation.
+///
+/// It either contains the result value or is in the error state,
+/// if the operation would have under/overflowed.
+/// Unlike [ts::checked_arithmetic]() it does not throw,
+/// so overflow becomes a branch on a flag,
+/// usable in `-fno-exceptions` builds.
+/// \requires `T` must be trivially copyable.
+/// \module types
+template <typename T>
+class arith_result
+{
+public:
+    /// \effects Creates it containing the result `value`.
+    TYPE_SAFE_FORCE_INLINE constexpr arith_result(T value) noexcept : value_(value), error_(false)
+    {}
+
+    /// \effects Creates it in the error state.
+    TYPE_SAFE_FORCE_INLINE constexpr arith_result(arith_error) noexcept : dummy_{}, error_(true)
+    {}
+
+    /// \returns `true` if it contains a value, `false` if the operation errored.
+    TYPE_SAFE_FORCE_INLINE explicit constexpr operator bool() const noexcept
+    {
+        return !error_;
+    }
+
+    /// \returns The contained value.
+    /// \requires It must not be in the error state.
+    TYPE_SAFE_FORCE_INLINE constexpr T value() const noexcept
+    {
+        return error_ ? DEBUG_UNREACHABLE(detail::precondition_error_handler{},
+                                          "arithmetic operation errored")
+                      : value_;
+    }
+
+    /// \returns The contained value or `fallback`, if it is in the error state.
+    TYPE_SAFE_FORCE_INLINE constexpr T value_or(T fallback) const noexcept
+    {
+        return error_ ? fallback : value_;
+    }
+
+private:
+    struct dummy
+    {};
+    union
+    {
+        dummy dummy_;
+        T     value_;
+    };
+    bool error_;
+};
+
 #if TYPE_SAFE_ARITHMETIC_POLICY == 1
 /// The default `ArithmeticPolicy`.
 ///
@@ -250,6 +485,8 @@ public:
 using arithmetic_policy_default = undefined_behavior_arithmetic;
 #elif TYPE_SAFE_ARITHMETIC_POLICY == 2
 using arithmetic_policy_default = checked_arithmetic;
+#elif TYPE_SAFE_ARITHMETIC_POLICY == 3
+using arithmetic_policy_default = saturating_arithmetic;
 #else
 using arithmetic_policy_default = default_arithmetic;
 #endif
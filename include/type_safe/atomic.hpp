@@ -0,0 +1,280 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_ATOMIC_HPP_INCLUDED
+#define TYPE_SAFE_ATOMIC_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <atomic>
+#    include <type_traits>
+#endif
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    // Maps a (wrapper) type to the raw type stored in the std::atomic
+    // and converts between the two.
+    template <typename T, typename = void>
+    struct atomic_traits
+    {
+        static_assert(sizeof(T) != sizeof(T),
+                      "type is not supported by ts::atomic, "
+                      "must be an integer, boolean or integer-backed strong typedef");
+    };
+
+    template <typename T>
+    struct atomic_traits<T, typename std::enable_if<std::is_integral<T>::value>::type>
+    {
+        using storage_type = T;
+
+        static constexpr storage_type to_raw(const T& value) noexcept
+        {
+            return value;
+        }
+        static constexpr T from_raw(storage_type raw) noexcept
+        {
+            return raw;
+        }
+    };
+
+    template <typename IntegerT, class Policy>
+    struct atomic_traits<integer<IntegerT, Policy>>
+    {
+        using storage_type = IntegerT;
+
+        static constexpr storage_type to_raw(const integer<IntegerT, Policy>& value) noexcept
+        {
+            return static_cast<IntegerT>(value);
+        }
+        static constexpr integer<IntegerT, Policy> from_raw(storage_type raw) noexcept
+        {
+            return integer<IntegerT, Policy>(raw);
+        }
+    };
+
+    template <>
+    struct atomic_traits<boolean>
+    {
+        using storage_type = bool;
+
+        static constexpr storage_type to_raw(const boolean& value) noexcept
+        {
+            return static_cast<bool>(value);
+        }
+        static constexpr boolean from_raw(storage_type raw) noexcept
+        {
+            return boolean(raw);
+        }
+    };
+
+    template <typename T>
+    struct atomic_traits<
+        T, typename std::enable_if<
+               is_strong_typedef<T>::value
+               && std::is_integral<type_safe::underlying_type<T>>::value>::type>
+    {
+        using storage_type = type_safe::underlying_type<T>;
+
+        static constexpr storage_type to_raw(const T& value) noexcept
+        {
+            return get(value);
+        }
+        static constexpr T from_raw(storage_type raw) noexcept
+        {
+            return T(raw);
+        }
+    };
+} // namespace detail
+
+/// A [std::atomic]() for the type safe wrapper types.
+///
+/// The value is stored as the raw underlying type,
+/// so all operations map to the native read-modify-write instructions
+/// (`lock xadd` etc.) instead of a compare-exchange loop,
+/// while the interface takes and returns the wrapped type.
+/// It is usable with [ts::integer](), [ts::boolean](),
+/// integer-backed [ts::strong_typedef]()s and raw integral types.
+/// \module types
+template <typename T>
+class atomic
+{
+    using traits       = detail::atomic_traits<T>;
+    using storage_type = typename traits::storage_type;
+
+public:
+    using value_type = T;
+
+    atomic() noexcept = default;
+
+    /// \effects Initializes it with the given value.
+    constexpr atomic(T desired) noexcept : storage_(traits::to_raw(desired)) {}
+
+    atomic(const atomic&)            = delete;
+    atomic& operator=(const atomic&) = delete;
+
+    /// \returns Whether the operations on it are lock-free.
+    bool is_lock_free() const noexcept
+    {
+        return storage_.is_lock_free();
+    }
+
+    /// \effects Atomically stores the given value.
+    /// \group store
+    void store(T desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        storage_.store(traits::to_raw(desired), order);
+    }
+
+    /// \group store
+    T operator=(T desired) noexcept
+    {
+        store(desired);
+        return desired;
+    }
+
+    /// \returns The current value.
+    /// \group load
+    T load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return traits::from_raw(storage_.load(order));
+    }
+
+    /// \group load
+    operator T() const noexcept
+    {
+        return load();
+    }
+
+    /// \effects Atomically replaces the value.
+    /// \returns The previous value.
+    T exchange(T desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.exchange(traits::to_raw(desired), order));
+    }
+
+    /// \effects Atomically compares the value to `expected`
+    /// and replaces it with `desired` if they are equal,
+    /// otherwise updates `expected` with the current value.
+    /// \returns Whether the exchange happened.
+    /// \group cmpxchg_weak
+    bool compare_exchange_weak(T& expected, T desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+    {
+        auto raw    = traits::to_raw(expected);
+        auto result = storage_.compare_exchange_weak(raw, traits::to_raw(desired), success,
+                                                     failure);
+        if (!result)
+            expected = traits::from_raw(raw);
+        return result;
+    }
+
+    /// \group cmpxchg_weak
+    bool compare_exchange_weak(T& expected, T desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto raw    = traits::to_raw(expected);
+        auto result = storage_.compare_exchange_weak(raw, traits::to_raw(desired), order);
+        if (!result)
+            expected = traits::from_raw(raw);
+        return result;
+    }
+
+    /// \group cmpxchg_strong
+    bool compare_exchange_strong(T& expected, T desired, std::memory_order success,
+                                 std::memory_order failure) noexcept
+    {
+        auto raw    = traits::to_raw(expected);
+        auto result = storage_.compare_exchange_strong(raw, traits::to_raw(desired), success,
+                                                       failure);
+        if (!result)
+            expected = traits::from_raw(raw);
+        return result;
+    }
+
+    /// \group cmpxchg_strong
+    bool compare_exchange_strong(T& expected, T desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto raw    = traits::to_raw(expected);
+        auto result = storage_.compare_exchange_strong(raw, traits::to_raw(desired), order);
+        if (!result)
+            expected = traits::from_raw(raw);
+        return result;
+    }
+
+    //=== arithmetic operations ===//
+    /// \effects Atomically applies the operation to the value.
+    /// \returns The previous value.
+    /// \notes These functions are only available
+    /// if the underlying type supports the operation.
+    /// \group fetch
+    T fetch_add(T operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.fetch_add(traits::to_raw(operand), order));
+    }
+
+    /// \group fetch
+    T fetch_sub(T operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.fetch_sub(traits::to_raw(operand), order));
+    }
+
+    /// \group fetch
+    T fetch_and(T operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.fetch_and(traits::to_raw(operand), order));
+    }
+
+    /// \group fetch
+    T fetch_or(T operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.fetch_or(traits::to_raw(operand), order));
+    }
+
+    /// \group fetch
+    T fetch_xor(T operand, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return traits::from_raw(storage_.fetch_xor(traits::to_raw(operand), order));
+    }
+
+    /// \effects Atomically increments/decrements the value.
+    /// \returns The new value.
+    /// \group incr
+    T operator++() noexcept
+    {
+        return traits::from_raw(storage_type(++storage_));
+    }
+
+    /// \group incr
+    T operator++(int) noexcept
+    {
+        return traits::from_raw(storage_type(storage_++));
+    }
+
+    /// \group incr
+    T operator--() noexcept
+    {
+        return traits::from_raw(storage_type(--storage_));
+    }
+
+    /// \group incr
+    T operator--(int) noexcept
+    {
+        return traits::from_raw(storage_type(storage_--));
+    }
+
+private:
+    std::atomic<storage_type> storage_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_ATOMIC_HPP_INCLUDED
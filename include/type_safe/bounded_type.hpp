@@ -8,6 +8,7 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 #endif
@@ -23,6 +24,25 @@ namespace constraints
     struct dynamic_bound
     {};
 
+    /// A bound for [ts::constraints::bounded]() that lives outside the objects.
+    ///
+    /// All constraints using the same `shared_bound` type reference one out-of-line value,
+    /// which can be changed at runtime — for example kept in sync with a container size.
+    /// Like a static bound it occupies zero bytes in every object,
+    /// so a large array of bounded values is as big as an array of the raw values.
+    /// `Tag` differentiates independent shared bounds of the same type.
+    /// \notes Changing the value does not re-verify already constructed objects,
+    /// and it is not synchronized — do not change it concurrently with verification.
+    template <typename T, class Tag>
+    struct shared_bound
+    {
+        static T value;
+    };
+
+    /// \exclude
+    template <typename T, class Tag>
+    T shared_bound<T, Tag>::value{};
+
     /// \exclude
     namespace detail
     {
@@ -39,6 +59,14 @@ namespace constraints
         struct is_dynamic : std::is_same<Bound, dynamic_bound>
         {};
 
+        template <typename Bound>
+        struct is_shared : std::false_type
+        {};
+
+        template <typename T, class Tag>
+        struct is_shared<shared_bound<T, Tag>> : std::true_type
+        {};
+
         template <bool Cond, typename T, typename Bound>
         struct select_bound;
 
@@ -202,6 +230,33 @@ namespace constraints
         template <typename U>
         using decay_same = std::is_same<typename std::decay<U>::type, T>;
 
+        // A closed lower bound of zero can never fail for an unsigned value,
+        // so the whole check folds to the single upper compare (`x <= upper`).
+        // Only a static bound qualifies; dynamic and shared bounds are runtime values.
+        template <typename U,
+                  bool Runtime = lower_is_dynamic || detail::is_shared<LowerBound>::value,
+                  typename Bound = LowerBound>
+        struct lower_never_fails : std::false_type
+        {};
+
+        template <typename U, typename Bound>
+        struct lower_never_fails<U, false, Bound>
+        : std::integral_constant<bool, LowerInclusive && std::is_unsigned<U>::value
+                                           && (Bound::value == 0)>
+        {};
+
+        template <typename U>
+        constexpr bool check(const U& u, std::false_type) const
+        {
+            return lower()(u) && upper()(u);
+        }
+
+        template <typename U>
+        constexpr bool check(const U& u, std::true_type) const
+        {
+            return upper()(u);
+        }
+
     public:
         using value_type  = T;
         using lower_bound = LowerBound;
@@ -239,10 +294,12 @@ namespace constraints
         {}
 
         /// Does the bounds check.
+        /// \notes For an unsigned value with a static, closed lower bound of zero
+        /// this is guaranteed to be a single compare against the upper bound.
         template <typename U>
         constexpr bool operator()(const U& u) const
         {
-            return lower()(u) && upper()(u);
+            return check(u, lower_never_fails<U>{});
         }
 
         /// \returns The value of the lower bound.
@@ -383,6 +440,23 @@ inline namespace literals
             static_assert(std::is_signed<T>::value, "must be a signed integer type");
             return {};
         }
+
+        template <typename T, T Value>
+        struct integer_value
+        {
+            static constexpr T value = Value;
+        };
+
+        template <typename T, T Value>
+        constexpr T integer_value<T, Value>::value;
+
+        template <typename T, T Value>
+        constexpr auto operator-(integer_value<T, Value>) noexcept
+            -> integer_value<T, Value * T(-1)>
+        {
+            static_assert(std::is_signed<T>::value, "must be a signed integer type");
+            return {};
+        }
     } // namespace lit_detail
 
     /// Creates a static bound for [ts::bounded_type]().
@@ -408,6 +482,32 @@ inline namespace literals
     {
         return {};
     }
+
+    /// Creates a static value for [ts::make_bounded]().
+    ///
+    /// Unlike `_bound` it represents the value being constrained, not a bound:
+    /// passing it to [ts::make_bounded]() together with static bounds
+    /// validates the range with a `static_assert`,
+    /// so the verifier never has to emit a runtime check in the first place.
+    /// You can use it for example like this `ts::make_bounded(5_bounded, 0_bound, 100_bound)`.
+    /// \returns A type representing the given value,
+    /// the value has type `long long` (1)/`unsigned long long` (2).
+    /// \group bounded_lit
+    template <char... Digits>
+    constexpr auto operator"" _bounded()
+        -> lit_detail::integer_value<long long, detail::parse<long long, Digits...>()>
+    {
+        return {};
+    }
+
+    /// \group bounded_lit
+    template <char... Digits>
+    constexpr auto operator"" _boundedu()
+        -> lit_detail::integer_value<unsigned long long,
+                                     detail::parse<unsigned long long, Digits...>()>
+    {
+        return {};
+    }
 } // namespace literals
 
 /// Creates a [ts::bounded_type]() to a specified [ts::constraints::closed_interval]().
@@ -428,6 +528,23 @@ constexpr auto make_bounded(T&& value, U1&& lower, U2&& upper)
                                                                   std::forward<U2>(upper)));
 }
 
+/// Creates a [ts::bounded_type]() where the value and both bounds are compile-time constants.
+/// \returns A [ts::bounded_type]() with the given static bounds containing `Value`.
+/// \notes The range is validated by a `static_assert` instead of the verifier,
+/// an out of range literal is a compile error and a valid one constant-folds entirely.
+template <typename T, T Value, typename U1, U1 Lower, typename U2, U2 Upper>
+constexpr auto make_bounded(lit_detail::integer_value<T, Value>,
+                            lit_detail::integer_bound<U1, Lower> lower,
+                            lit_detail::integer_bound<U2, Upper> upper)
+    -> detail::make_bounded_type<assertion_verifier, true, true, T,
+                                 lit_detail::integer_bound<U1, Lower>,
+                                 lit_detail::integer_bound<U2, Upper>>
+{
+    static_assert(T(Lower) <= Value && Value <= T(Upper),
+                  "bounded literal outside its static bounds");
+    return make_bounded(T(Value), lower, upper);
+}
+
 /// Creates a [ts::bounded_type]() to a specified [ts::constraints::closed_interval]().
 /// \returns A [ts::bounded_type]() with the given `value` and lower and upper bounds,
 /// where the bounds are valid values as well.
@@ -487,24 +604,74 @@ constexpr auto sanitize_bounded_exclusive(T&& value, U1&& lower, U2&& upper)
                                                                   std::forward<U2>(upper)));
 }
 
+/// \exclude
+namespace detail
+{
+    // The two single-sided selects of the form `x < y ? y : x`
+    // map directly to the hardware min/max instructions for arithmetic types,
+    // unlike a three-way conditional which may compile to branches.
+    template <typename T, typename Bound>
+    constexpr T clamp_lower(T value, const Bound& lower)
+    {
+        return value < lower ? static_cast<T>(lower) : value;
+    }
+
+    template <typename T, typename Bound>
+    constexpr T clamp_upper(T value, const Bound& upper)
+    {
+        return upper < value ? static_cast<T>(upper) : value;
+    }
+} // namespace detail
+
 /// Returns a copy of `val` so that it is in the given [ts::constraints::closed_interval]().
 /// \effects If it is not in the interval, returns the bound that is closer to the value.
+/// \notes This is composed of two single-sided min/max selects,
+/// so it compiles branchless for arithmetic types, including floats.
 /// \output_section clamped_type
 template <typename T, typename LowerBound, typename UpperBound, typename U>
 constexpr auto clamp(const constraints::closed_interval<T, LowerBound, UpperBound>& interval,
                      U&& val) -> typename std::decay<U>::type
 {
-    return val < interval.get_lower_bound()
-               ? static_cast<typename std::decay<U>::type>(interval.get_lower_bound())
-               : (val > interval.get_upper_bound()
-                      ? static_cast<typename std::decay<U>::type>(interval.get_upper_bound())
-                      : std::forward<U>(val));
+    return detail::clamp_upper(detail::clamp_lower(static_cast<typename std::decay<U>::type>(
+                                                       std::forward<U>(val)),
+                                                   interval.get_lower_bound()),
+                               interval.get_upper_bound());
+}
+
+/// Clamps every element of a contiguous buffer into the given
+/// [ts::constraints::closed_interval]() in place.
+/// \effects Same as `element = clamp(interval, element)` for every element.
+/// \notes The loop body is the branchless min/max select of [ts::clamp](),
+/// so the compiler can vectorize the sweep over the buffer.
+/// \group clamp_range
+template <typename T, typename LowerBound, typename UpperBound, typename U>
+void clamp_range(const constraints::closed_interval<T, LowerBound, UpperBound>& interval, U* ptr,
+                 std::size_t size)
+{
+    for (std::size_t i = 0u; i != size; ++i)
+        ptr[i] = detail::clamp_upper(detail::clamp_lower(ptr[i], interval.get_lower_bound()),
+                                     interval.get_upper_bound());
+}
+
+/// \group clamp_range
+/// \param 3
+/// \exclude
+template <typename T, typename LowerBound, typename UpperBound, class Container,
+          typename = decltype(std::declval<Container&>().data()
+                              + std::declval<Container&>().size())>
+void clamp_range(const constraints::closed_interval<T, LowerBound, UpperBound>& interval,
+                 Container& container)
+{
+    clamp_range(interval, container.data(), container.size());
 }
 
 /// A `Verifier` for [ts::constrained_type]() that clamps the value to make it valid.
 ///
 /// It must be used together with [ts::constraints::less_equal](),
 /// [ts::constraints::greater_equal]() or [ts::constraints::closed_interval]().
+///
+/// The clamped result fulfills the bound by construction,
+/// which is handed to the optimizer as an assumption on the returned value.
 struct clamping_verifier
 {
     /// \returns If `val` is greater than the bound of `p`,
@@ -514,8 +681,10 @@ struct clamping_verifier
     static constexpr auto verify(Value&& val, const constraints::less_equal<T, Bound>& p) ->
         typename std::decay<Value>::type
     {
-        return p(val) ? std::forward<Value>(val)
-                      : static_cast<typename std::decay<Value>::type>(p.get_bound());
+        return detail::assume_verified(p(val) ? std::forward<Value>(val)
+                                              : static_cast<typename std::decay<Value>::type>(
+                                                  p.get_bound()),
+                                       p);
     }
 
     /// \returns If `val` is less than the bound of `p`,
@@ -525,8 +694,10 @@ struct clamping_verifier
     static constexpr auto verify(Value&& val, const constraints::greater_equal<T, Bound>& p) ->
         typename std::decay<Value>::type
     {
-        return p(val) ? std::forward<Value>(val)
-                      : static_cast<typename std::decay<Value>::type>(p.get_bound());
+        return detail::assume_verified(p(val) ? std::forward<Value>(val)
+                                              : static_cast<typename std::decay<Value>::type>(
+                                                  p.get_bound()),
+                                       p);
     }
 
     /// \returns Same as `clamp(interval, val)`.
@@ -535,10 +706,19 @@ struct clamping_verifier
         Value&& val, const constraints::closed_interval<T, LowerBound, UpperBound>& interval) ->
         typename std::decay<Value>::type
     {
-        return clamp(interval, std::forward<Value>(val));
+        return detail::assume_verified(clamp(interval, std::forward<Value>(val)), interval);
     }
 };
 
+/// \exclude
+namespace detail
+{
+    // a clamped value fulfills the bound by construction
+    template <>
+    struct verifier_establishes_constraint<clamping_verifier> : std::true_type
+    {};
+} // namespace detail
+
 /// An alias for [ts::constrained_type]() that uses [ts::constraints::closed_interval]() as its
 /// `Constraint` and [ts::clamping_verifier]() as its `Verifier`. \notes This is some type where the
 /// values are always clamped so that they are in a certain interval.
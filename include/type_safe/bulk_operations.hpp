@@ -0,0 +1,467 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_BULK_OPERATIONS_HPP_INCLUDED
+#define TYPE_SAFE_BULK_OPERATIONS_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <thread>
+#    include <vector>
+#endif
+
+#include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/boolean.hpp>
+#include <type_safe/deferred_construction.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/narrow_cast.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    // Each operation bundles the overflow predicate with a wrapping evaluation,
+    // so the fast path of a block is a branchless loop the compiler can vectorize,
+    // plus the policy evaluation used to replay a failing block.
+    struct bulk_addition_op
+    {
+        template <typename T>
+        static constexpr bool will_error(T a, T b) noexcept
+        {
+            return will_addition_error(arithmetic_tag_for<T>{}, a, b);
+        }
+        template <typename T>
+        static constexpr T compute(T a, T b) noexcept
+        {
+            return wrapping_arithmetic::do_addition(a, b);
+        }
+        template <class Policy, typename T>
+        static constexpr T compute_policy(T a, T b)
+        {
+            return Policy::template do_addition<T>(a, b);
+        }
+    };
+
+    struct bulk_subtraction_op
+    {
+        template <typename T>
+        static constexpr bool will_error(T a, T b) noexcept
+        {
+            return will_subtraction_error(arithmetic_tag_for<T>{}, a, b);
+        }
+        template <typename T>
+        static constexpr T compute(T a, T b) noexcept
+        {
+            return wrapping_arithmetic::do_subtraction(a, b);
+        }
+        template <class Policy, typename T>
+        static constexpr T compute_policy(T a, T b)
+        {
+            return Policy::template do_subtraction<T>(a, b);
+        }
+    };
+
+    struct bulk_multiplication_op
+    {
+        template <typename T>
+        static constexpr bool will_error(T a, T b) noexcept
+        {
+            return will_multiplication_error(arithmetic_tag_for<T>{}, a, b);
+        }
+        template <typename T>
+        static constexpr T compute(T a, T b) noexcept
+        {
+            return wrapping_arithmetic::do_multiplication(a, b);
+        }
+        template <class Policy, typename T>
+        static constexpr T compute_policy(T a, T b)
+        {
+            return Policy::template do_multiplication<T>(a, b);
+        }
+    };
+
+    // The number of elements whose overflow flags are aggregated into a single check.
+    constexpr std::size_t bulk_block_size = 64u;
+} // namespace detail
+
+/// Tag objects that select the operation of a [ts::checked_transform]().
+/// \group bulk_op_tag Bulk operation tags
+/// \module types
+constexpr detail::bulk_addition_op bulk_add{};
+/// \group bulk_op_tag
+constexpr detail::bulk_subtraction_op bulk_sub{};
+/// \group bulk_op_tag
+constexpr detail::bulk_multiplication_op bulk_mul{};
+
+/// \effects Applies the operation selected by `op` to every element of `src`
+/// and the scalar `operand`, storing the results into `dst`.
+///
+/// Unlike a loop over the checked operators of [ts::integer](),
+/// the overflow flags of a whole block of elements are aggregated
+/// and checked once per block,
+/// so the per-element work is branchless and can be vectorized.
+/// Only a block that actually contains an error is replayed element-wise
+/// through the `Policy` of the operands, raising the policy's error.
+/// \requires `src.size() == dst.size()`; the ranges must not partially overlap.
+/// \module types
+/// \group checked_transform Checked bulk transformation
+template <typename T, class Policy, class Op>
+void checked_transform(const array_ref<const integer<T, Policy>>& src,
+                       const array_ref<integer<T, Policy>>& dst, const integer<T, Policy>& operand,
+                       Op)
+{
+    TYPE_SAFE_DETAIL_ASSERT(src.size() == dst.size(), detail::precondition_error_handler{},
+                            "mismatched array sizes");
+
+    auto in  = src.data();
+    auto out = dst.data();
+    auto b   = static_cast<T>(operand);
+
+    auto size = static_cast<std::size_t>(src.size());
+    for (std::size_t i = 0u; i != size;)
+    {
+        auto block_end
+            = size - i > detail::bulk_block_size ? i + detail::bulk_block_size : size;
+
+        auto error = 0;
+        for (auto j = i; j != block_end; ++j)
+            error |= int(Op::will_error(in[j].get(), b));
+
+        if (error == 0)
+            for (auto j = i; j != block_end; ++j)
+                out[j] = integer<T, Policy>(Op::compute(in[j].get(), b));
+        else
+            for (auto j = i; j != block_end; ++j)
+                out[j] = integer<T, Policy>(Op::template compute_policy<Policy>(in[j].get(), b));
+
+        i = block_end;
+    }
+}
+
+/// \effects The same, but the operation is applied element-wise to `src` and `operands`.
+/// \requires `src.size() == operands.size() == dst.size()`; the ranges must not partially overlap.
+/// \module types
+/// \group checked_transform
+template <typename T, class Policy, class Op>
+void checked_transform(const array_ref<const integer<T, Policy>>& src,
+                       const array_ref<const integer<T, Policy>>& operands,
+                       const array_ref<integer<T, Policy>>& dst, Op)
+{
+    TYPE_SAFE_DETAIL_ASSERT(src.size() == operands.size() && src.size() == dst.size(),
+                            detail::precondition_error_handler{}, "mismatched array sizes");
+
+    auto in    = src.data();
+    auto other = operands.data();
+    auto out   = dst.data();
+
+    auto size = static_cast<std::size_t>(src.size());
+    for (std::size_t i = 0u; i != size;)
+    {
+        auto block_end
+            = size - i > detail::bulk_block_size ? i + detail::bulk_block_size : size;
+
+        auto error = 0;
+        for (auto j = i; j != block_end; ++j)
+            error |= int(Op::will_error(in[j].get(), other[j].get()));
+
+        if (error == 0)
+            for (auto j = i; j != block_end; ++j)
+                out[j] = integer<T, Policy>(Op::compute(in[j].get(), other[j].get()));
+        else
+            for (auto j = i; j != block_end; ++j)
+                out[j] = integer<T, Policy>(
+                    Op::template compute_policy<Policy>(in[j].get(), other[j].get()));
+
+        i = block_end;
+    }
+}
+/// \exclude
+namespace detail
+{
+    template <typename T>
+    struct bulk_underlying_type
+    {
+        using type = T;
+    };
+    template <typename T, class Policy>
+    struct bulk_underlying_type<integer<T, Policy>>
+    {
+        using type = T;
+    };
+    template <typename T>
+    struct bulk_underlying_type<floating_point<T>>
+    {
+        using type = T;
+    };
+
+    template <typename T>
+    constexpr T bulk_get(const T& value) noexcept
+    {
+        return value;
+    }
+    template <typename T, class Policy>
+    constexpr T bulk_get(const integer<T, Policy>& value) noexcept
+    {
+        return value.get();
+    }
+    template <typename T>
+    constexpr T bulk_get(const floating_point<T>& value) noexcept
+    {
+        return value.get();
+    }
+} // namespace detail
+
+/// \effects Converts every element of `src` to the element type of `dst`
+/// like [ts::narrow_cast]() does for a single value.
+///
+/// The representability check is done as a branchless scan over the whole input
+/// whose verdicts are aggregated into a single flag,
+/// followed by a plain conversion loop,
+/// so both passes can be vectorized.
+/// \returns `src.size()` if all elements were converted,
+/// otherwise the index of the first element that is not representable by the target type;
+/// in that case `dst` is left unchanged.
+/// \requires `src.size() == dst.size()`; the ranges must not overlap.
+/// \module types
+template <typename In, typename Out>
+size_t narrow_cast_range(const array_ref<const In>& src, const array_ref<Out>& dst)
+{
+    TYPE_SAFE_DETAIL_ASSERT(src.size() == dst.size(), detail::precondition_error_handler{},
+                            "mismatched array sizes");
+    using underlying = typename detail::bulk_underlying_type<Out>::type;
+
+    auto in   = src.data();
+    auto out  = dst.data();
+    auto size = static_cast<std::size_t>(src.size());
+
+    auto error = 0;
+    for (std::size_t i = 0u; i != size; ++i)
+        error |= int(detail::is_narrowing<underlying>(detail::bulk_get(in[i])));
+
+    if (error != 0)
+    {
+        std::size_t i = 0u;
+        while (!detail::is_narrowing<underlying>(detail::bulk_get(in[i])))
+            ++i;
+        return size_t(i);
+    }
+
+    for (std::size_t i = 0u; i != size; ++i)
+        out[i] = Out(static_cast<underlying>(detail::bulk_get(in[i])));
+    return size_t(size);
+}
+
+/// \returns Whether every element of `flags` is `true`.
+///
+/// The verdicts are folded into a bitwise accumulator instead of short-circuiting,
+/// so the scan over the byte storage is branch-free and can be vectorized.
+/// \module types
+/// \group bool_bulk Bulk boolean queries
+inline boolean all_of(const array_ref<const boolean>& flags) noexcept
+{
+    auto in   = flags.data();
+    auto size = static_cast<std::size_t>(flags.size());
+
+    auto all = 1u;
+    for (std::size_t i = 0u; i != size; ++i)
+        all &= unsigned(static_cast<bool>(in[i]));
+    return boolean(all != 0u);
+}
+
+/// \returns Whether any element of `flags` is `true`.
+/// \group bool_bulk
+inline boolean any_of(const array_ref<const boolean>& flags) noexcept
+{
+    auto in   = flags.data();
+    auto size = static_cast<std::size_t>(flags.size());
+
+    auto any = 0u;
+    for (std::size_t i = 0u; i != size; ++i)
+        any |= unsigned(static_cast<bool>(in[i]));
+    return boolean(any != 0u);
+}
+
+/// \returns The number of elements of `flags` that are `true`.
+/// \group bool_bulk
+inline size_t count(const array_ref<const boolean>& flags) noexcept
+{
+    auto in   = flags.data();
+    auto size = static_cast<std::size_t>(flags.size());
+
+    std::size_t n = 0u;
+    for (std::size_t i = 0u; i != size; ++i)
+        n += unsigned(static_cast<bool>(in[i]));
+    return size_t(n);
+}
+
+/// A typed half-open range `[first, last)` of [ts::index_t]() values,
+/// as produced by [ts::partition]().
+/// \group parallel Typed parallel partitioning
+struct index_range
+{
+    index_t first;
+    index_t last;
+
+    /// \returns The number of indices in the range.
+    size_t size() const noexcept
+    {
+        return get(last) - get(first);
+    }
+};
+
+/// Splits `[begin, end)` into at most `n_chunks` consecutive subranges for worker threads.
+///
+/// The chunks cover the range exactly once and are as even as possible,
+/// but every boundary except the last is a multiple of `granularity` elements from `begin`.
+/// With `granularity * sizeof(element)` at least the cache line size,
+/// no two chunks touch the same cache line,
+/// so workers writing to their chunk never false-share;
+/// the default of `64` elements guarantees that for any element size.
+/// \returns The chunks in order; fewer than `n_chunks` if the range has too few granules,
+/// none if it is empty.
+/// \requires `begin <= end`, `n_chunks > 0` and `granularity > 0`.
+/// \group parallel
+inline std::vector<index_range> partition(index_t begin, index_t end, unsigned n_chunks,
+                                          size_t granularity = size_t(64u))
+{
+    TYPE_SAFE_DETAIL_ASSERT(get(begin) <= get(end), detail::precondition_error_handler{},
+                            "invalid index range");
+    TYPE_SAFE_DETAIL_ASSERT(n_chunks > 0u && granularity > 0u, detail::precondition_error_handler{},
+                            "invalid partition");
+
+    auto first = static_cast<std::size_t>(get(begin));
+    auto last  = static_cast<std::size_t>(get(end));
+    auto gran  = static_cast<std::size_t>(granularity);
+
+    auto granules = (last - first + gran - 1u) / gran;
+    auto chunks   = granules < n_chunks ? granules : std::size_t(n_chunks);
+
+    std::vector<index_range> result;
+    result.reserve(chunks);
+
+    auto per_chunk = chunks == 0u ? std::size_t(0u) : granules / chunks;
+    auto remainder = chunks == 0u ? std::size_t(0u) : granules % chunks;
+    auto pos       = first;
+    for (std::size_t i = 0u; i != chunks; ++i)
+    {
+        auto next = pos + (per_chunk + (i < remainder ? 1u : 0u)) * gran;
+        if (next > last)
+            next = last;
+        result.push_back(index_range{index_t(pos), index_t(next)});
+        pos = next;
+    }
+    return result;
+}
+
+/// \effects Partitions `range` like [ts::partition]() and invokes `f(first, last)`
+/// once per chunk, each chunk on its own thread and the first on the calling thread,
+/// then waits for all of them.
+/// `f` receives the chunk bounds as [ts::index_t](),
+/// so kernels stay typed instead of chunking on raw integers.
+/// \throws Anything thrown by `f` on the calling thread, after all workers finished;
+/// an exception leaving `f` on a worker thread terminates, like in a plain thread.
+/// \notes `n_chunks == 0u` (the default) uses one chunk per hardware thread.
+/// \group parallel
+template <typename Func>
+void parallel_for(const index_range& range, Func f, unsigned n_chunks = 0u)
+{
+    if (n_chunks == 0u)
+    {
+        n_chunks = std::thread::hardware_concurrency();
+        if (n_chunks == 0u)
+            n_chunks = 1u;
+    }
+
+    auto chunks = partition(range.first, range.last, n_chunks);
+    if (chunks.empty())
+        return;
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks.size() - 1u);
+    for (std::size_t i = 1u; i != chunks.size(); ++i)
+    {
+        auto chunk = chunks[i];
+        threads.emplace_back([&f, chunk] { f(chunk.first, chunk.last); });
+    }
+
+    TYPE_SAFE_TRY
+    {
+        f(chunks[0u].first, chunks[0u].last);
+    }
+    TYPE_SAFE_CATCH_ALL
+    {
+        for (auto& thread : threads)
+            thread.join();
+        TYPE_SAFE_RETHROW;
+    }
+    for (auto& thread : threads)
+        thread.join();
+}
+
+/// \effects Partitions the array of [ts::deferred_construction]() slots like [ts::partition]()
+/// and emplaces every slot concurrently with the result of `gen(index)`,
+/// one thread per chunk with the first chunk on the calling thread.
+/// The slots are independent objects, so beyond the final join no synchronization is needed.
+///
+/// An exception leaving `gen` only fails that one element:
+/// its index is recorded, the slot stays un-initialized and construction continues,
+/// so a caller can retry or drop exactly the failed elements.
+/// \returns The indices whose construction failed, in ascending order; empty on full success.
+/// \requires All slots must be un-initialized.
+/// \notes `n_chunks == 0u` (the default) uses one chunk per hardware thread.
+/// \group parallel
+template <typename T, typename Generator>
+std::vector<index_t> construct_parallel(const array_ref<deferred_construction<T>>& slots,
+                                        Generator gen, unsigned n_chunks = 0u)
+{
+    if (n_chunks == 0u)
+    {
+        n_chunks = std::thread::hardware_concurrency();
+        if (n_chunks == 0u)
+            n_chunks = 1u;
+    }
+
+    auto chunks
+        = partition(index_t(0u), index_t(static_cast<std::size_t>(slots.size())), n_chunks);
+
+    // one failure list per worker, merged after the join
+    std::vector<std::vector<index_t>> failed(chunks.size());
+
+    auto worker = [&](std::size_t chunk) {
+        auto first = static_cast<std::size_t>(get(chunks[chunk].first));
+        auto last  = static_cast<std::size_t>(get(chunks[chunk].last));
+        for (auto i = first; i != last; ++i)
+            TYPE_SAFE_TRY
+            {
+                slots[index_t(i)].emplace(gen(index_t(i)));
+            }
+            TYPE_SAFE_CATCH_ALL
+            {
+                failed[chunk].push_back(index_t(i));
+            }
+    };
+
+    std::vector<std::thread> threads;
+    if (!chunks.empty())
+    {
+        threads.reserve(chunks.size() - 1u);
+        for (std::size_t i = 1u; i != chunks.size(); ++i)
+            threads.emplace_back(worker, i);
+        worker(0u);
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<index_t> result;
+    for (auto& list : failed)
+        result.insert(result.end(), list.begin(), list.end());
+    return result;
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_BULK_OPERATIONS_HPP_INCLUDED
@@ -0,0 +1,171 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_CHARCONV_HPP_INCLUDED
+#define TYPE_SAFE_CHARCONV_HPP_INCLUDED
+
+#include <type_safe/config.hpp>
+
+#ifndef TYPE_SAFE_USE_CHARCONV
+/// Controls whether the [std::to_chars]()/[std::from_chars]() overloads
+/// for the wrapper types are provided.
+///
+/// It is enabled by default when `<charconv>` is available in C++17 mode.
+#    if defined(__has_include)
+#        if __has_include(<charconv>)                                                              \
+            && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+/// \exclude
+#            define TYPE_SAFE_USE_CHARCONV 1
+#        else
+#            define TYPE_SAFE_USE_CHARCONV 0
+#        endif
+#    else
+#        define TYPE_SAFE_USE_CHARCONV 0
+#    endif
+#endif
+
+#if TYPE_SAFE_USE_CHARCONV
+
+#    if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#    else
+#        include <charconv>
+#    endif
+
+#    include <type_safe/constrained_type.hpp>
+#    include <type_safe/floating_point.hpp>
+#    include <type_safe/integer.hpp>
+#    include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+//=== integer ===//
+/// [std::to_chars]() for [ts::integer]().
+/// \module types
+template <typename IntegerT, class Policy>
+std::to_chars_result to_chars(char* first, char* last, const integer<IntegerT, Policy>& value,
+                              int base = 10) noexcept
+{
+    return std::to_chars(first, last, static_cast<IntegerT>(value), base);
+}
+
+/// [std::from_chars]() for [ts::integer]().
+/// \effects Only writes to `value` if the parse succeeded.
+/// \module types
+template <typename IntegerT, class Policy>
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  integer<IntegerT, Policy>& value, int base = 10) noexcept
+{
+    IntegerT raw{};
+    auto     result = std::from_chars(first, last, raw, base);
+    if (result.ec == std::errc())
+        value = raw;
+    return result;
+}
+
+//=== floating_point ===//
+#    if defined(__cpp_lib_to_chars)
+/// [std::to_chars]() for [ts::floating_point]().
+/// \module types
+/// \group float_to_chars
+template <typename FloatT>
+std::to_chars_result to_chars(char* first, char* last, const floating_point<FloatT>& value) noexcept
+{
+    return std::to_chars(first, last, static_cast<FloatT>(value));
+}
+
+/// \group float_to_chars
+template <typename FloatT>
+std::to_chars_result to_chars(char* first, char* last, const floating_point<FloatT>& value,
+                              std::chars_format fmt) noexcept
+{
+    return std::to_chars(first, last, static_cast<FloatT>(value), fmt);
+}
+
+/// \group float_to_chars
+template <typename FloatT>
+std::to_chars_result to_chars(char* first, char* last, const floating_point<FloatT>& value,
+                              std::chars_format fmt, int precision) noexcept
+{
+    return std::to_chars(first, last, static_cast<FloatT>(value), fmt, precision);
+}
+
+/// [std::from_chars]() for [ts::floating_point]().
+/// \effects Only writes to `value` if the parse succeeded.
+/// \module types
+template <typename FloatT>
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  floating_point<FloatT>&   value,
+                                  std::chars_format fmt = std::chars_format::general) noexcept
+{
+    FloatT raw{};
+    auto   result = std::from_chars(first, last, raw, fmt);
+    if (result.ec == std::errc())
+        value = raw;
+    return result;
+}
+#    endif
+
+//=== strong_typedef ===//
+/// [std::to_chars]() for integer-backed [ts::strong_typedef]()s.
+/// \module types
+/// \param 1
+/// \exclude
+template <class StrongTypedef,
+          typename = typename std::enable_if<
+              is_strong_typedef<StrongTypedef>::value
+              && std::is_integral<underlying_type<StrongTypedef>>::value>::type>
+std::to_chars_result to_chars(char* first, char* last, const StrongTypedef& value,
+                              int base = 10) noexcept
+{
+    return std::to_chars(first, last, get(value), base);
+}
+
+/// [std::from_chars]() for integer-backed [ts::strong_typedef]()s.
+/// \effects Only writes to `value` if the parse succeeded.
+/// \module types
+/// \param 1
+/// \exclude
+template <class StrongTypedef,
+          typename = typename std::enable_if<
+              is_strong_typedef<StrongTypedef>::value
+              && std::is_integral<underlying_type<StrongTypedef>>::value>::type>
+std::from_chars_result from_chars(const char* first, const char* last, StrongTypedef& value,
+                                  int base = 10) noexcept
+{
+    return std::from_chars(first, last, get(value), base);
+}
+
+//=== constrained_type ===//
+/// [std::to_chars]() for [ts::constrained_type]() (e.g. [ts::bounded_type]()).
+/// \module types
+template <typename T, typename Constraint, class Verifier>
+std::to_chars_result to_chars(char* first, char* last,
+                              const constrained_type<T, Constraint, Verifier>& value) noexcept
+{
+    using std::to_chars;
+    return to_chars(first, last, value.get_value());
+}
+
+/// [std::from_chars]() for [ts::constrained_type]() (e.g. [ts::bounded_type]()).
+/// \effects Parses into the value type first
+/// and verifies the constraint exactly once after a successful parse.
+/// Only writes to `value` if the parse succeeded.
+/// \module types
+template <typename T, typename Constraint, class Verifier>
+std::from_chars_result from_chars(const char* first, const char* last,
+                                  constrained_type<T, Constraint, Verifier>& value)
+{
+    using std::from_chars;
+    auto raw    = value.get_value();
+    auto result = from_chars(first, last, raw);
+    if (result.ec == std::errc())
+        value = raw;
+    return result;
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_USE_CHARCONV
+
+#endif // TYPE_SAFE_CHARCONV_HPP_INCLUDED
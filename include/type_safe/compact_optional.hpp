@@ -12,7 +12,11 @@ import std;
 #include <type_traits>
 #endif
 
+#include <type_safe/boolean.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
 #include <type_safe/optional.hpp>
+#include <type_safe/strong_typedef.hpp>
 
 namespace type_safe
 {
@@ -61,8 +65,15 @@ public:
     using const_rvalue_reference
         = detail::storage_reference<storage_type, value_type, const value_type&&>;
 
+    /// Monadic operations like `map()` that produce the same `value_type` again
+    /// stay in the compacted representation,
+    /// only a different result type decompresses into a [ts::direct_optional_storage]().
+    /// \notes A mapped result equal to the invalid value lands in the niche
+    /// and yields an empty optional, see `create_value()`.
     template <typename U>
-    using rebind = direct_optional_storage<U>;
+    using rebind = typename std::conditional<
+        std::is_same<typename std::remove_cv<U>::type, value_type>::value,
+        compact_optional_storage<CompactPolicy>, direct_optional_storage<U>>::type;
 
     /// \effects Initializes it in the state without value,
     /// i.e. sets the storage to the invalid value.
@@ -70,10 +81,14 @@ public:
 
     /// \effects Creates a temporary `value_type` by perfectly forwarding `args`,
     /// converts that to the `storage_type` and assigns it.
-    /// Afterwards `has_value()` will return `true`.
+    /// Afterwards `has_value()` will return `true`,
+    /// unless the created value equals the invalid value:
+    /// the niche cannot distinguish the two, so the optional is empty instead.
+    /// This keeps monadic operations whose callback legitimately produces the invalid value
+    /// well-defined, they yield an empty optional.
     /// \throws Anything thrown by the constructor of `value_type`/`storage_type` or its move
     /// assignment operator in which case `has_value()` is still `false`. \requires `has_value() ==
-    /// false` and the given value must not be invalid. \notes This function does not participate in
+    /// false`. \notes This function does not participate in
     /// overload resolution unless `value_type` is constructible from `args`. \synopsis template
     /// \<typename ... Args\>\nvoid create_value(Args&&... args);
     template <typename... Args>
@@ -81,8 +96,6 @@ public:
         typename std::enable_if<std::is_constructible<value_type, Args&&...>::value>::type
     {
         storage_ = static_cast<storage_type>(value_type(std::forward<Args>(args)...));
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{},
-                     "create_value() called creating an invalid value");
     }
 
     /// \effects Copy assigns the `storage_type`.
@@ -164,14 +177,18 @@ public:
 
     /// \returns Either `get_value()` or `u` converted to `value_type`.
     /// \requires `value_type` must be copy (1)/move (2) constructible and `u` convertible to
-    /// `value_type`. \group get_value_or \param 1 \exclude
+    /// `value_type`. \notes Both operands are evaluated up front,
+    /// so the select against the invalid sentinel has no data dependent branch
+    /// and compiles to a conditional move.
+    /// \group get_value_or \param 1 \exclude
     template <typename U,
               typename
               = typename std::enable_if<std::is_copy_constructible<value_type>::value
                                         && std::is_convertible<U&&, value_type>::value>::type>
     value_type get_value_or(U&& u) const TYPE_SAFE_LVALUE_REF
     {
-        return has_value() ? get_value() : static_cast<value_type>(std::forward<U>(u));
+        auto fallback = static_cast<value_type>(std::forward<U>(u));
+        return has_value() ? get_value() : fallback;
     }
 
 #if TYPE_SAFE_USE_REF_QUALIFIERS
@@ -184,7 +201,8 @@ public:
                                         && std::is_convertible<U&&, value_type>::value>::type>
     value_type get_value_or(U&& u) &&
     {
-        return has_value() ? std::move(get_value()) : static_cast<value_type>(std::forward<U>(u));
+        auto fallback = static_cast<value_type>(std::forward<U>(u));
+        return has_value() ? std::move(get_value()) : std::move(fallback);
     }
 #endif
 
@@ -344,6 +362,184 @@ public:
         return static_cast<bool>(detail::is_empty(0, storage));
     }
 };
+
+/// A `CompactPolicy` for [ts::compact_optional_storage]() for pointer types.
+///
+/// `nullptr` will be used to mark an empty optional.
+/// \module optional
+template <typename Pointer>
+class compact_pointer_policy
+{
+    static_assert(std::is_pointer<Pointer>::value, "must be a pointer");
+
+public:
+    using value_type   = Pointer;
+    using storage_type = Pointer;
+
+    static storage_type invalid_value() noexcept
+    {
+        return nullptr;
+    }
+
+    static bool is_invalid(const storage_type& storage) noexcept
+    {
+        return storage == nullptr;
+    }
+};
+
+/// Customization point for [ts::compact_optional_for]().
+///
+/// Specialize it for your own type and provide the members of a `CompactPolicy`
+/// (`value_type`, `storage_type`, `invalid_value()` and `is_invalid()`)
+/// to teach [ts::compact_optional_for]() the niche representation of the type.
+/// \module optional
+template <typename T>
+class custom_niche
+{};
+
+/// \exclude
+namespace detail
+{
+    template <typename T, typename = void>
+    struct has_custom_niche : std::false_type
+    {};
+
+    template <typename T>
+    struct has_custom_niche<T, void_t<typename custom_niche<T>::storage_type>> : std::true_type
+    {};
+
+    // a niche whose empty state is the maximum value of the underlying integer
+    template <typename T, typename Integer>
+    class max_integer_niche_policy
+    {
+    public:
+        using value_type   = T;
+        using storage_type = Integer;
+
+        static storage_type invalid_value() noexcept
+        {
+            return std::numeric_limits<Integer>::max();
+        }
+
+        static bool is_invalid(const storage_type& storage) noexcept
+        {
+            return storage == invalid_value();
+        }
+    };
+
+    // a niche whose empty state is a quiet NaN of the underlying floating point
+    template <typename T, typename Float>
+    class nan_niche_policy
+    {
+    public:
+        using value_type   = T;
+        using storage_type = Float;
+
+        static storage_type invalid_value() noexcept
+        {
+            return std::numeric_limits<Float>::quiet_NaN();
+        }
+
+        static bool is_invalid(const storage_type& storage) noexcept
+        {
+            // NaN is not equal to anything
+            return storage != storage;
+        }
+    };
+
+    template <typename T, typename = void>
+    struct auto_niche_policy
+    {
+        static_assert(sizeof(T) != sizeof(T),
+                      "no niche representation known for this type, "
+                      "specialize ts::custom_niche");
+    };
+
+    template <typename T>
+    struct auto_niche_policy<T, typename std::enable_if<has_custom_niche<T>::value>::type>
+    {
+        using type = custom_niche<T>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<T,
+                             typename std::enable_if<!has_custom_niche<T>::value
+                                                     && (std::is_same<T, bool>::value
+                                                         || std::is_same<T, boolean>::value)>::type>
+    {
+        using type = compact_bool_policy<T>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<T, typename std::enable_if<!has_custom_niche<T>::value
+                                                        && std::is_integral<T>::value
+                                                        && !std::is_same<T, bool>::value>::type>
+    {
+        using type = max_integer_niche_policy<T, T>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<T, typename std::enable_if<!has_custom_niche<T>::value
+                                                        && std::is_floating_point<T>::value>::type>
+    {
+        using type = compact_floating_point_policy<T>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<
+        T, typename std::enable_if<!has_custom_niche<T>::value && std::is_enum<T>::value>::type>
+    {
+        using type = max_integer_niche_policy<T, typename std::underlying_type<T>::type>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<
+        T, typename std::enable_if<!has_custom_niche<T>::value && std::is_pointer<T>::value>::type>
+    {
+        using type = compact_pointer_policy<T>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<
+        T, typename std::enable_if<
+               !has_custom_niche<T>::value && is_strong_typedef<T>::value
+               && std::is_integral<type_safe::underlying_type<T>>::value>::type>
+    {
+        using type = max_integer_niche_policy<T, type_safe::underlying_type<T>>;
+    };
+
+    template <typename T>
+    struct auto_niche_policy<
+        T, typename std::enable_if<
+               !has_custom_niche<T>::value && is_strong_typedef<T>::value
+               && std::is_floating_point<type_safe::underlying_type<T>>::value>::type>
+    {
+        using type = nan_niche_policy<T, type_safe::underlying_type<T>>;
+    };
+
+    template <typename IntegerT, class Policy>
+    struct auto_niche_policy<integer<IntegerT, Policy>, void>
+    {
+        using type = max_integer_niche_policy<integer<IntegerT, Policy>, IntegerT>;
+    };
+
+    template <typename FloatT>
+    struct auto_niche_policy<floating_point<FloatT>, void>
+    {
+        using type = nan_niche_policy<floating_point<FloatT>, FloatT>;
+    };
+} // namespace detail
+
+/// An alias for [ts::compact_optional]() that automatically picks a niche representation for `T`.
+///
+/// The niche is detected by introspecting the type:
+/// the maximum value for integers, [ts::integer](), integer-backed [ts::strong_typedef]()s and
+/// enumerations, a quiet `NaN` for floating points, [ts::floating_point]() and floating point
+/// backed [ts::strong_typedef]()s, `nullptr` for pointers, and an invalid `char` for
+/// `bool`/[ts::boolean](). Other types can opt-in by specializing [ts::custom_niche](). The
+/// resulting optional needs no more storage than `T` itself. \module optional
+template <typename T>
+using compact_optional_for = compact_optional<typename detail::auto_niche_policy<T>::type>;
 } // namespace type_safe
 
 #endif // TYPE_SAFE_COMPACT_OPTIONAL_HPP_INCLUDED
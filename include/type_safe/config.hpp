@@ -10,6 +10,11 @@ import std;
 #else
 #include <cstddef>
 #include <cstdlib>
+#if defined(__has_include)
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
 #endif
 
 #ifndef TYPE_SAFE_ENABLE_ASSERTIONS
@@ -35,7 +40,7 @@ import std;
 
 #ifndef TYPE_SAFE_ARITHMETIC_POLICY
 /// Controls whether [ts::arithmetic_policy_default]() is [ts::undefined_behavior_arithmetic](),
-/// [ts::checked_arithmetic](), or [ts::default_arithmetic]().
+/// [ts::checked_arithmetic](), [ts::saturating_arithmetic](), or [ts::default_arithmetic]().
 ///
 /// It is [ts::undefined_behavior_arithmetic]() by default.
 #    define TYPE_SAFE_ARITHMETIC_POLICY 1
@@ -123,6 +128,157 @@ import std;
 #    define TYPE_SAFE_CONSTEXPR14
 #endif
 
+#ifndef TYPE_SAFE_USE_CONSTEXPR20
+
+/// Controls whether the storage of the wrapper types uses constexpr placement
+/// (a union activated with `std::construct_at()` instead of placement new into a byte buffer),
+/// which makes them usable in constant expressions and `constinit` tables.
+///
+/// It is enabled by default when C++20 constexpr, concepts,
+/// and `std::construct_at()` are all available.
+#    if defined(__cpp_constexpr) && __cpp_constexpr >= 201907                                      \
+        && defined(__cpp_concepts) && defined(__cpp_lib_constexpr_dynamic_alloc)                   \
+        && __cpp_lib_constexpr_dynamic_alloc >= 201907
+/// \exclude
+#        define TYPE_SAFE_USE_CONSTEXPR20 1
+#    else
+/// \exclude
+#        define TYPE_SAFE_USE_CONSTEXPR20 0
+#    endif
+
+#endif
+
+#if TYPE_SAFE_USE_CONSTEXPR20
+/// \exclude
+#    define TYPE_SAFE_CONSTEXPR20 constexpr
+#else
+/// \exclude
+#    define TYPE_SAFE_CONSTEXPR20
+#endif
+
+#ifndef TYPE_SAFE_USE_THREE_WAY_COMPARISON
+
+#    if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907     \
+        && defined(__cpp_lib_three_way_comparison) && __cpp_lib_three_way_comparison >= 201907
+/// \exclude
+#        define TYPE_SAFE_USE_THREE_WAY_COMPARISON 1
+#    else
+/// \exclude
+#        define TYPE_SAFE_USE_THREE_WAY_COMPARISON 0
+#    endif
+
+#endif
+
+#ifndef TYPE_SAFE_UNLIKELY
+#    if defined(__GNUC__) || defined(__clang__)
+/// Marks the condition of a verification branch as almost never true,
+/// so the compiler lays out the failure path out of line
+/// and keeps the fall-through path fast.
+/// It is expression-form (`__builtin_expect`) so it can be used inside `constexpr` ternaries.
+#        define TYPE_SAFE_UNLIKELY(Cond) __builtin_expect(!!(Cond), 0)
+/// \exclude
+#        define TYPE_SAFE_LIKELY(Cond) __builtin_expect(!!(Cond), 1)
+#    else
+#        define TYPE_SAFE_UNLIKELY(Cond) (Cond)
+#        define TYPE_SAFE_LIKELY(Cond) (Cond)
+#    endif
+#endif
+
+#ifndef TYPE_SAFE_COLD
+#    if defined(__GNUC__) || defined(__clang__)
+/// Outlines a failure handler: never inlined and placed in the cold section,
+/// so the hot code footprint only pays for the call instruction.
+#        define TYPE_SAFE_COLD __attribute__((cold, noinline))
+#    elif defined(_MSC_VER)
+#        define TYPE_SAFE_COLD __declspec(noinline)
+#    else
+#        define TYPE_SAFE_COLD
+#    endif
+#endif
+
+#ifndef TYPE_SAFE_PREFETCH
+#    if defined(__GNUC__) || defined(__clang__)
+/// Issues a read prefetch of the cache line containing `Ptr`,
+/// hiding the memory latency of a predictable future access.
+/// Without the builtin the address is discarded unevaluated, so it is free to use in loops.
+#        define TYPE_SAFE_PREFETCH(Ptr) __builtin_prefetch((Ptr), 0, 3)
+#    else
+#        define TYPE_SAFE_PREFETCH(Ptr) static_cast<void>(sizeof((Ptr)))
+#    endif
+#endif
+
+#ifndef TYPE_SAFE_RESTRICT
+#    if defined(__GNUC__) || defined(__clang__)
+/// The compiler's spelling of C's `restrict` qualifier:
+/// a promise that the object is not accessed through any other pointer,
+/// which unblocks vectorization of loops with several pointer parameters.
+#        define TYPE_SAFE_RESTRICT __restrict__
+#    elif defined(_MSC_VER)
+#        define TYPE_SAFE_RESTRICT __restrict
+#    else
+#        define TYPE_SAFE_RESTRICT
+#    endif
+#endif
+
+#ifndef TYPE_SAFE_ASSUME
+#    if defined(__clang__)
+/// Promises the optimizer that `Cond` is true without generating a check for it,
+/// so comparisons and bounds checks implied by `Cond` later on fold away.
+/// It is expression-form so it can be used inside `constexpr` ternaries;
+/// the C++23 `[[assume]]` attribute is statement-form and thus not usable here.
+/// \notes Depending on the compiler `Cond` may or may not be evaluated,
+/// it must not have side effects.
+#        define TYPE_SAFE_ASSUME(Cond) __builtin_assume(Cond)
+#    elif defined(__GNUC__)
+#        define TYPE_SAFE_ASSUME(Cond) ((Cond) ? static_cast<void>(0) : __builtin_unreachable())
+#    elif defined(_MSC_VER)
+#        define TYPE_SAFE_ASSUME(Cond) __assume(Cond)
+#    else
+#        define TYPE_SAFE_ASSUME(Cond) static_cast<void>(sizeof((Cond)))
+#    endif
+#endif
+
+#ifndef TYPE_SAFE_USE_IS_FINAL
+
+#    if defined(__cpp_lib_is_final) && __cpp_lib_is_final >= 201402
+/// \exclude
+#        define TYPE_SAFE_USE_IS_FINAL 1
+#    elif __cplusplus >= 201402L
+/// \exclude
+#        define TYPE_SAFE_USE_IS_FINAL 1
+#    elif defined(_MSC_VER) && _MSC_VER >= 1900
+#        define TYPE_SAFE_USE_IS_FINAL 1
+#    else
+#        define TYPE_SAFE_USE_IS_FINAL 0
+#    endif
+
+#endif
+
+#ifndef TYPE_SAFE_USE_OVERFLOW_BUILTINS
+
+/// Controls whether the arithmetic policies detect over/underflow
+/// using the compiler overflow builtins (`__builtin_add_overflow` etc.),
+/// which read the flag directly from the ALU,
+/// instead of the portable comparison based implementation.
+///
+/// It is enabled by default whenever the builtins are available
+/// and usable in `constexpr` (they require a C++14 function body).
+#    if defined(__has_builtin) && TYPE_SAFE_USE_CONSTEXPR14
+#        if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow)         \
+            && __has_builtin(__builtin_mul_overflow)
+/// \exclude
+#            define TYPE_SAFE_USE_OVERFLOW_BUILTINS 1
+#        else
+#            define TYPE_SAFE_USE_OVERFLOW_BUILTINS 0
+#        endif
+#    elif defined(__GNUC__) && __GNUC__ >= 5 && TYPE_SAFE_USE_CONSTEXPR14
+#        define TYPE_SAFE_USE_OVERFLOW_BUILTINS 1
+#    else
+#        define TYPE_SAFE_USE_OVERFLOW_BUILTINS 0
+#    endif
+
+#endif
+
 #ifndef TYPE_SAFE_USE_EXCEPTIONS
 
 #    if __cpp_exceptions
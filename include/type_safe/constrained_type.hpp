@@ -8,24 +8,64 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
 #include <iterator>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #endif
 
 #include <type_safe/config.hpp>
 #include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/force_inline.hpp>
 #include <type_safe/detail/is_nothrow_swappable.hpp>
 
 namespace type_safe
 {
 //=== constrained_type ===//
+/// \exclude
+namespace detail
+{
+    // Whether a verifier guarantees that a value it returned fulfills the constraint,
+    // so accessors may re-state the predicate as an optimizer assumption.
+    // It defaults to `false`:
+    // a verifier that tolerates violations or never checks must not promise the invariant.
+    template <class Verifier>
+    struct verifier_establishes_constraint : std::false_type
+    {};
+
+    // re-states a just-verified predicate as an optimizer assumption on the value
+    template <typename Value, typename Predicate>
+    TYPE_SAFE_FORCE_INLINE constexpr Value&& assume_verified(Value&& val, const Predicate& p)
+    {
+        return TYPE_SAFE_ASSUME(p(val)), std::forward<Value>(val);
+    }
+
+    template <class Verifier, typename Value, typename Predicate>
+    TYPE_SAFE_FORCE_INLINE constexpr auto assume_constraint(const Value& val, const Predicate& p)
+        -> typename std::enable_if<verifier_establishes_constraint<Verifier>::value, bool>::type
+    {
+        return TYPE_SAFE_ASSUME(p(val)), true;
+    }
+    template <class Verifier, typename Value, typename Predicate>
+    TYPE_SAFE_FORCE_INLINE constexpr auto assume_constraint(const Value&, const Predicate&)
+        -> typename std::enable_if<!verifier_establishes_constraint<Verifier>::value, bool>::type
+    {
+        return true;
+    }
+} // namespace detail
+
 /// A `Verifier` for [ts::constrained_type]() that `DEBUG_ASSERT`s the constraint.
 ///
 /// If [TYPE_SAFE_ENABLE_PRECONDITION_CHECKS]() is `true`,
 /// it will assert that the value fulfills the predicate and returns it unchanged.
 /// If assertions are disabled, it will just return the value unchanged.
+///
+/// Either way the predicate is handed to the optimizer as an assumption on the returned value,
+/// so bounds checks and clamps implied by the constraint fold away downstream.
 /// \output_section Constrained type
 struct assertion_verifier
 {
@@ -33,10 +73,11 @@ struct assertion_verifier
     static constexpr auto verify(Value&& val, const Predicate& p) ->
         typename std::decay<Value>::type
     {
-        return p(val) ? std::forward<Value>(val)
-                      : (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
-                                           "value does not fulfill constraint"),
-                         std::forward<Value>(val));
+        return TYPE_SAFE_LIKELY(p(val))
+                   ? detail::assume_verified(std::forward<Value>(val), p)
+                   : (DEBUG_UNREACHABLE(detail::precondition_error_handler{},
+                                        "value does not fulfill constraint"),
+                      std::forward<Value>(val));
     }
 };
 
@@ -49,6 +90,20 @@ public:
     {}
 };
 
+/// \exclude
+namespace detail
+{
+    // the failure path is outlined and marked cold,
+    // so a verification leaves only the predicate and a predicted-not-taken call inline
+    [[noreturn]] TYPE_SAFE_COLD inline void on_constrain_error()
+    {
+        TYPE_SAFE_THROW(constrain_error{});
+#if !TYPE_SAFE_USE_EXCEPTIONS
+        std::abort();
+#endif
+    }
+} // namespace detail
+
 /// A `Verifier` for [ts::constrained_type]() that throws an exception in case of failure.
 ///
 /// Unlike [ts::assertion_verifier](), it will *always* check the constrain.
@@ -65,11 +120,73 @@ struct throwing_verifier
     static constexpr auto verify(Value&& val, const Predicate& p) ->
         typename std::decay<Value>::type
     {
-        return p(val) ? std::forward<Value>(val)
-                      : (TYPE_SAFE_THROW(constrain_error{}), std::forward<Value>(val));
+        return TYPE_SAFE_LIKELY(p(val))
+                   ? detail::assume_verified(std::forward<Value>(val), p)
+                   : (detail::on_constrain_error(), std::forward<Value>(val));
     }
 };
 
+/// \exclude
+namespace detail
+{
+    // both verifiers only ever return values fulfilling the predicate
+    template <>
+    struct verifier_establishes_constraint<assertion_verifier> : std::true_type
+    {};
+    template <>
+    struct verifier_establishes_constraint<throwing_verifier> : std::true_type
+    {};
+} // namespace detail
+
+/// A `Verifier` for [ts::constrained_type]() that checks only every `N`th invocation.
+///
+/// Checking every operation is often too expensive for production builds,
+/// but compiling all checks out loses all signal.
+/// This verifier advances a cheap thread-local counter per invocation
+/// and runs the predicate only when the counter wraps,
+/// a branch that is almost never taken and predicted as such.
+/// A detected violation is not fatal, the value is returned unchanged;
+/// instead a relaxed atomic counter is incremented,
+/// which monitoring can scrape via [*violations]().
+/// This gives statistical invariant coverage at a fraction of the checking cost.
+template <std::size_t N>
+struct sampling_verifier
+{
+    static_assert(N != 0u, "sampling period must not be zero");
+
+    /// \returns The number of violations detected so far, over all threads.
+    static std::size_t violations() noexcept
+    {
+        return violation_count.load(std::memory_order_relaxed);
+    }
+
+    /// \effects Resets the violation counter to zero.
+    static void reset_violations() noexcept
+    {
+        violation_count.store(0u, std::memory_order_relaxed);
+    }
+
+    template <typename Value, typename Predicate>
+    static auto verify(Value&& val, const Predicate& p) -> typename std::decay<Value>::type
+    {
+        thread_local std::size_t counter = 0u;
+        if (TYPE_SAFE_UNLIKELY(++counter >= N))
+        {
+            counter = 0u;
+            if (TYPE_SAFE_UNLIKELY(!p(val)))
+                violation_count.fetch_add(1u, std::memory_order_relaxed);
+        }
+        return std::forward<Value>(val);
+    }
+
+private:
+    static std::atomic<std::size_t> violation_count;
+};
+
+/// \exclude
+template <std::size_t N>
+std::atomic<std::size_t> sampling_verifier<N>::violation_count;
+
 /// \exclude
 namespace detail
 {
@@ -208,6 +325,23 @@ public:
         return constrained_modifier<T, Constraint, Verifier>(*this);
     }
 
+    /// \effects Calls `f` with a non-`const` reference to the stored value
+    /// followed by the additional arguments,
+    /// and verifies the constraint exactly once after `f` returns,
+    /// no matter how many mutations `f` performs.
+    /// \notes Use this instead of repeated `modify()` calls
+    /// when a batch of mutations only establishes the constraint at the end.
+    /// \notes This function does not participate in overload resolution if `T` is `const`.
+    /// \param 3
+    /// \exclude
+    template <typename Func, typename... Args, typename Dummy = T,
+              typename = typename std::enable_if<!std::is_const<Dummy>::value>::type>
+    void bulk_modify(Func&& f, Args&&... additional_args)
+    {
+        std::forward<Func>(f)(value_, std::forward<Args>(additional_args)...);
+        Verifier::verify(value_, get_constraint());
+    }
+
     /// \effects Moves the stored value out of the `constrained_type`,
     /// it will not be checked further.
     /// \returns An rvalue reference to the stored value.
@@ -251,7 +385,9 @@ private:
 #if TYPE_SAFE_ENABLE_ASSERTIONS
         return Verifier::verify(value_, get_constraint()), value_;
 #else
-        return value_;
+        // the invariant is guaranteed by construction,
+        // so hand it to the optimizer even without the checks
+        return detail::assume_constraint<Verifier>(value_, get_constraint()), value_;
 #endif
     }
 
@@ -297,6 +433,21 @@ public:
         return constrained_modifier<T&, Constraint, Verifier>(*this);
     }
 
+    /// \effects Calls `f` with a non-`const` reference to the referred value
+    /// followed by the additional arguments,
+    /// and verifies the constraint exactly once after `f` returns,
+    /// no matter how many mutations `f` performs.
+    /// \notes This function does not participate in overload resolution if `T` is `const`.
+    /// \param 3
+    /// \exclude
+    template <typename Func, typename... Args, typename Dummy = T,
+              typename = typename std::enable_if<!std::is_const<Dummy>::value>::type>
+    void bulk_modify(Func&& f, Args&&... additional_args)
+    {
+        std::forward<Func>(f)(*ref_, std::forward<Args>(additional_args)...);
+        Verifier::verify(*ref_, get_constraint());
+    }
+
     /// Dereference operator.
     /// \returns A `const` reference to the referred value.
     constexpr const value_type& operator*() const noexcept
@@ -329,7 +480,9 @@ private:
 #if TYPE_SAFE_ENABLE_ASSERTIONS
         return Verifier::verify(*ref_, get_constraint());
 #else
-        return *ref_;
+        // the invariant is guaranteed by construction,
+        // so hand it to the optimizer even without the checks
+        return detail::assume_constraint<Verifier>(*ref_, get_constraint()), *ref_;
 #endif
     }
 
@@ -398,7 +551,7 @@ public:
     /// \requires It must not be in the moved-from state.
     value_type& get() noexcept
     {
-        DEBUG_ASSERT(value_, detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(value_, detail::precondition_error_handler{});
         return value_->get_non_const();
     }
 
@@ -496,6 +649,214 @@ void with(constrained_type<T, Constraint, Verifier>& value, Func&& f, Args&&...
     std::forward<Func>(f)(modifier.get(), std::forward<Args>(additional_args)...);
 }
 
+/// A scope that batches the verification of several [ts::constrained_type]() objects.
+///
+/// It holds one [ts::constrained_modifier]() per object,
+/// so write access via [*get]() is unverified
+/// and each constraint is checked exactly once when the group is destroyed,
+/// with the `Verifier` semantics of the corresponding object.
+/// Use it when a batch of mutations temporarily breaks the constraints
+/// and only the combined result needs to be valid.
+template <class... ConstrainedTypes>
+class constrained_group
+{
+public:
+    /// \effects Creates a group giving write access to all given objects.
+    /// \requires The objects must live as long as the group.
+    explicit constrained_group(ConstrainedTypes&... objects) : modifiers_(objects.modify()...) {}
+
+    /// \effects Move constructs it.
+    /// `other` will not verify any value afterwards.
+    constrained_group(constrained_group&&) = default;
+
+    /// \effects Verifies all values that have not been moved from.
+    ~constrained_group() noexcept(false) = default;
+
+    /// \returns A reference to the stored value of the `I`th object, without verification.
+    /// \exclude return
+    template <std::size_t I>
+    auto get() noexcept -> decltype(std::get<I>(std::declval<
+                                        std::tuple<decltype(std::declval<ConstrainedTypes&>()
+                                                                .modify())...>&>())
+                                        .get())
+    {
+        return std::get<I>(modifiers_).get();
+    }
+
+private:
+    std::tuple<decltype(std::declval<ConstrainedTypes&>().modify())...> modifiers_;
+};
+
+/// Creates a [ts::constrained_group]() for the given objects.
+/// \returns A group whose destruction verifies all objects in one batch.
+template <class... ConstrainedTypes>
+constrained_group<ConstrainedTypes...> group_modify(ConstrainedTypes&... objects)
+{
+    return constrained_group<ConstrainedTypes...>(objects...);
+}
+
+//=== constrained_span ===//
+/// \exclude
+namespace detail
+{
+    // Reduces the validity of a whole range to a single flag.
+    // The loop carries no branch, only a flag conjunction,
+    // so the compiler can vectorize the predicate sweep.
+    template <typename T, class Constraint>
+    bool range_fulfills(const T* ptr, std::size_t size, const Constraint& c)
+    {
+        auto result = true;
+        for (std::size_t i = 0u; i != size; ++i)
+            result &= static_cast<bool>(c(ptr[i]));
+        return result;
+    }
+
+    // The predicate handed to the Verifier for a range check:
+    // it reports the precomputed result of the sweep,
+    // so the Verifier runs its failure handling exactly once per range.
+    struct range_fulfilled
+    {
+        bool result;
+
+        template <typename T>
+        constexpr bool operator()(const T&) const noexcept
+        {
+            return result;
+        }
+    };
+} // namespace detail
+
+/// A view to a contiguous buffer of values that all fulfill the predicate `Constraint`.
+///
+/// Unlike a container of [ts::constrained_type]() elements,
+/// which runs the predicate scalarly on every construction and assignment,
+/// the whole buffer is verified once at construction
+/// with a branchless sweep the compiler can vectorize,
+/// followed by a single `Verifier` check of the combined result.
+/// Access is `const` only, as unverified mutation could break the constraint.
+/// \requires The buffer must outlive the span and must not be modified
+/// in a way that breaks the constraint while the span exists.
+/// \output_section Constrained span
+template <typename T, class Constraint, class Verifier = assertion_verifier>
+class constrained_span : Constraint
+{
+public:
+    using value_type           = typename std::remove_cv<T>::type;
+    using constraint_predicate = Constraint;
+
+    /// \effects Creates a span to the `size` values starting at `ptr`,
+    /// verifying all of them in one sweep.
+    /// \throws Whatever the `Verifier` throws if an element is invalid.
+    constrained_span(const T* ptr, std::size_t size, constraint_predicate predicate = {})
+    : Constraint(std::move(predicate)), ptr_(ptr), size_(size)
+    {
+        Verifier::verify(size,
+                         detail::range_fulfilled{detail::range_fulfills(ptr, size,
+                                                                        get_constraint())});
+    }
+
+    /// \effects Creates a span to all elements of the given contiguous container.
+    /// \notes This constructor does not participate in overload resolution,
+    /// unless the container has contiguous `data()` and `size()`.
+    /// \param 1
+    /// \exclude
+    template <typename Container, typename = decltype(std::declval<const Container&>().data()
+                                                      + std::declval<const Container&>().size())>
+    explicit constrained_span(const Container& container, constraint_predicate predicate = {})
+    : constrained_span(container.data(), container.size(), std::move(predicate))
+    {}
+
+    /// \returns A `const` reference to the element at index `i`, without further checks.
+    /// \requires `i < size()`.
+    const value_type& operator[](std::size_t i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(TYPE_SAFE_LIKELY(i < size_), detail::precondition_error_handler{});
+        return ptr_[i];
+    }
+
+    /// \returns A `const` pointer to the first element (1)/an iterator to the first
+    /// element (2)/past the last element (3).
+    /// \group access
+    const value_type* data() const noexcept
+    {
+        return ptr_;
+    }
+
+    /// \group access
+    const value_type* begin() const noexcept
+    {
+        return ptr_;
+    }
+
+    /// \group access
+    const value_type* end() const noexcept
+    {
+        return ptr_ + size_;
+    }
+
+    /// \returns The number of elements.
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// \returns Whether the span is empty.
+    bool empty() const noexcept
+    {
+        return size_ == 0u;
+    }
+
+    /// \returns The predicate that determines validity.
+    const constraint_predicate& get_constraint() const noexcept
+    {
+        return *this;
+    }
+
+private:
+    const T*    ptr_;
+    std::size_t size_;
+};
+
+/// Creates a [ts::constrained_span]() verifying the whole range in one sweep.
+/// \returns A [ts::constrained_span]() to the given buffer (1, 2)/container (3, 4)
+/// with the given `Constraint` and `Verifier`.
+/// \group verify_range
+/// \unique_name verify_range_verifier
+template <class Verifier, typename T, class Constraint>
+constrained_span<T, Constraint, Verifier> verify_range(const T* ptr, std::size_t size, Constraint c)
+{
+    return constrained_span<T, Constraint, Verifier>(ptr, size, std::move(c));
+}
+
+/// \group verify_range
+/// \unique_name verify_range
+template <typename T, class Constraint>
+constrained_span<T, Constraint> verify_range(const T* ptr, std::size_t size, Constraint c)
+{
+    return constrained_span<T, Constraint>(ptr, size, std::move(c));
+}
+
+/// \group verify_range
+/// \unique_name verify_range_container_verifier
+/// \param 2
+/// \exclude
+template <class Verifier, class Container, class Constraint,
+          typename T = typename Container::value_type>
+constrained_span<T, Constraint, Verifier> verify_range(const Container& container, Constraint c)
+{
+    return constrained_span<T, Constraint, Verifier>(container, std::move(c));
+}
+
+/// \group verify_range
+/// \unique_name verify_range_container
+/// \param 2
+/// \exclude
+template <class Container, class Constraint, typename T = typename Container::value_type>
+constrained_span<T, Constraint> verify_range(const Container& container, Constraint c)
+{
+    return constrained_span<T, Constraint>(container, std::move(c));
+}
+
 //=== tagged_type ===//
 /// A `Verifier` for [ts::constrained_type]() that doesn't check the constraint.
 ///
@@ -0,0 +1,187 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_COROUTINE_HPP_INCLUDED
+#define TYPE_SAFE_COROUTINE_HPP_INCLUDED
+
+#include <type_safe/config.hpp>
+
+#ifndef TYPE_SAFE_USE_COROUTINES
+/// Controls whether the C++20 coroutine support for [ts::basic_optional]() is provided.
+///
+/// It is enabled by default when the compiler and library implement coroutines.
+#    if defined(__cpp_impl_coroutine) && defined(__has_include)
+#        if __has_include(<coroutine>)
+/// \exclude
+#            define TYPE_SAFE_USE_COROUTINES 1
+#        else
+#            define TYPE_SAFE_USE_COROUTINES 0
+#        endif
+#    else
+#        define TYPE_SAFE_USE_COROUTINES 0
+#    endif
+#endif
+
+#if TYPE_SAFE_USE_COROUTINES
+
+#    if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#    else
+#        include <coroutine>
+#    endif
+
+#    include <type_safe/optional.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    template <class StoragePolicy>
+    class optional_promise;
+
+    // The return object of an optional coroutine.
+    //
+    // The coroutine runs eagerly and suspends at the final suspend point
+    // (or at the first co_await of an empty optional),
+    // so the frame is still alive when the ramp converts the return object:
+    // the conversion steals the result and the destructor destroys the frame.
+    template <class StoragePolicy>
+    class optional_return_object
+    {
+    public:
+        using handle_type = std::coroutine_handle<optional_promise<StoragePolicy>>;
+
+        explicit optional_return_object(handle_type handle) noexcept : handle_(handle) {}
+
+        optional_return_object(optional_return_object&& other) noexcept : handle_(other.handle_)
+        {
+            other.handle_ = nullptr;
+        }
+
+        optional_return_object& operator=(optional_return_object&&) = delete;
+
+        ~optional_return_object() noexcept
+        {
+            if (handle_)
+                handle_.destroy();
+        }
+
+        operator basic_optional<StoragePolicy>()
+        {
+            return std::move(handle_.promise().result());
+        }
+
+    private:
+        handle_type handle_;
+    };
+
+    template <class StoragePolicy>
+    class optional_promise
+    {
+    public:
+        optional_return_object<StoragePolicy> get_return_object() noexcept
+        {
+            return optional_return_object<StoragePolicy>(
+                std::coroutine_handle<optional_promise>::from_promise(*this));
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        template <typename T>
+        void return_value(T&& value)
+        {
+            result_ = std::forward<T>(value);
+        }
+
+        void unhandled_exception()
+        {
+            TYPE_SAFE_RETHROW;
+        }
+
+        basic_optional<StoragePolicy>& result() noexcept
+        {
+            return result_;
+        }
+
+    private:
+        basic_optional<StoragePolicy> result_;
+    };
+
+    // Awaiting an optional inside an optional coroutine:
+    // an empty optional suspends the coroutine for good,
+    // making the coroutine itself return nullopt (short circuit);
+    // a non-empty optional hands out its value without suspending at all.
+    template <typename Optional>
+    struct optional_awaiter
+    {
+        Optional&& optional;
+
+        bool await_ready() const noexcept
+        {
+            return optional.has_value();
+        }
+
+        template <class StoragePolicy>
+        void await_suspend(std::coroutine_handle<optional_promise<StoragePolicy>>) const noexcept
+        {
+            // the promise result is still empty and the frame
+            // is destroyed by the return object, nothing to do
+        }
+
+        decltype(auto) await_resume()
+        {
+            return std::forward<Optional>(optional).value();
+        }
+    };
+} // namespace detail
+
+/// `co_await` for [ts::basic_optional]().
+///
+/// Inside a coroutine returning an optional,
+/// `co_await`-ing an optional either yields the value it contains,
+/// or stops the coroutine and makes it return [ts::nullopt]() (short circuit).
+/// The coroutine executes synchronously and never escapes its handle,
+/// so the compiler can elide the frame allocation.
+/// \module optional
+/// \group optional_co_await
+template <class StoragePolicy>
+detail::optional_awaiter<const basic_optional<StoragePolicy>&> operator co_await(
+    const basic_optional<StoragePolicy>& optional) noexcept
+{
+    return {optional};
+}
+
+/// \group optional_co_await
+template <class StoragePolicy>
+detail::optional_awaiter<basic_optional<StoragePolicy>> operator co_await(
+    basic_optional<StoragePolicy>&& optional) noexcept
+{
+    return {std::move(optional)};
+}
+} // namespace type_safe
+
+namespace std
+{
+/// Makes [ts::basic_optional]() usable as a coroutine return type.
+/// \module optional
+/// \exclude target
+template <class StoragePolicy, typename... Args>
+struct coroutine_traits<type_safe::basic_optional<StoragePolicy>, Args...>
+{
+    using promise_type = type_safe::detail::optional_promise<StoragePolicy>;
+};
+} // namespace std
+
+#endif // TYPE_SAFE_USE_COROUTINES
+
+#endif // TYPE_SAFE_COROUTINE_HPP_INCLUDED
@@ -8,6 +8,7 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <cstddef>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -107,7 +108,7 @@ public:
     template <typename... Args>
     void emplace(Args&&... args)
     {
-        DEBUG_ASSERT(!has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(!has_value(), detail::precondition_error_handler{});
         ::new (as_void()) value_type(std::forward<Args>(args)...);
         initialized_ = true;
     }
@@ -132,14 +133,14 @@ public:
     /// \group value
     value_type& value() TYPE_SAFE_LVALUE_REF noexcept
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return *static_cast<value_type*>(as_void());
     }
 
     /// \group value
     const value_type& value() const TYPE_SAFE_LVALUE_REF noexcept
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return *static_cast<const value_type*>(as_void());
     }
 
@@ -147,14 +148,14 @@ public:
     /// \group value
     value_type&& value() && noexcept
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return std::move(*static_cast<value_type*>(as_void()));
     }
 
     /// \group value
     const value_type&& value() const&& noexcept
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return std::move(*static_cast<const value_type*>(as_void()));
     }
 #endif
@@ -174,6 +175,120 @@ private:
     bool      initialized_;
 };
 
+/// A fixed-capacity arena of [ts::deferred_construction]() slots.
+///
+/// It makes a single allocation upfront and hands out un-initialized slots in O(1),
+/// so many objects can be created lazily without eagerly constructing them
+/// and without a heap allocation per object.
+///
+/// Slots stay valid until the pool is `reset()` or destroyed;
+/// `reset()` returns all slots at once
+/// and does not invoke a single destructor when `T` is trivially destructible.
+template <typename T>
+class deferred_pool
+{
+public:
+    using value_type = T;
+    using slot_type  = deferred_construction<T>;
+    using size_type  = std::size_t;
+
+    //=== constructors/destructor ===//
+    /// \effects Creates a pool with the given number of slots,
+    /// allocating the storage for all of them at once.
+    /// No slot is acquired and no `T` object is constructed yet.
+    explicit deferred_pool(size_type capacity)
+    : storage_(new storage_type[capacity]), capacity_(capacity), acquired_(0u)
+    {}
+
+    /// \group delete_copy
+    deferred_pool(const deferred_pool&) = delete;
+
+    /// \effects Moves the pool, transferring ownership of the storage and all slots.
+    /// `other` will be a pool without any slots afterwards.
+    deferred_pool(deferred_pool&& other) noexcept
+    : storage_(other.storage_), capacity_(other.capacity_), acquired_(other.acquired_)
+    {
+        other.storage_  = nullptr;
+        other.capacity_ = 0u;
+        other.acquired_ = 0u;
+    }
+
+    /// \effects Same as `reset()`, then frees the storage.
+    ~deferred_pool() noexcept
+    {
+        reset();
+        delete[] storage_;
+    }
+
+    /// \group delete_copy
+    deferred_pool& operator=(const deferred_pool&) = delete;
+    /// \group delete_copy
+    deferred_pool& operator=(deferred_pool&&) = delete;
+
+    //=== modifiers ===//
+    /// \effects Acquires the next slot of the pool.
+    /// \returns A reference to an un-initialized [ts::deferred_construction]() object,
+    /// it stays valid until the pool is `reset()` or destroyed.
+    /// \requires `acquired() < capacity()`.
+    /// \output_section Modifiers
+    slot_type& acquire()
+    {
+        TYPE_SAFE_DETAIL_ASSERT(acquired_ < capacity_, detail::precondition_error_handler{});
+        auto slot = ::new (static_cast<void*>(storage_ + acquired_)) slot_type();
+        ++acquired_;
+        return *slot;
+    }
+
+    /// \effects Returns all slots to the pool at once,
+    /// destroying every value that was initialized.
+    /// If `T` is trivially destructible, no destructor is invoked at all.
+    /// \notes All references previously returned by `acquire()` are invalidated.
+    void reset() noexcept
+    {
+        destroy(std::is_trivially_destructible<T>{});
+        acquired_ = 0u;
+    }
+
+    //=== observers ===//
+    /// \returns The number of slots acquired so far.
+    /// \output_section Observers
+    size_type acquired() const noexcept
+    {
+        return acquired_;
+    }
+
+    /// \returns The total number of slots of the pool.
+    size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+private:
+    struct storage_type
+    {
+        alignas(slot_type) unsigned char memory[sizeof(slot_type)];
+    };
+
+    // a trivially destructible value cannot have observable destruction side effects,
+    // so the slots can simply be abandoned and their storage reused
+    void destroy(std::true_type) noexcept {}
+
+    void destroy(std::false_type) noexcept
+    {
+        for (auto i = acquired_; i != 0u; --i)
+            slot(i - 1u)->~slot_type();
+    }
+
+    slot_type* slot(size_type i) noexcept
+    {
+        return reinterpret_cast<slot_type*>(storage_[i].memory);
+    }
+
+    storage_type* storage_;
+    size_type     capacity_;
+    size_type     acquired_;
+};
+
 } // namespace type_safe
 
 #endif // TYPE_SAFE_DEFER_CONSTRUCTION_HPP_INCLUDED
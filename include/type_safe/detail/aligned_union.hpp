@@ -35,6 +35,14 @@ namespace detail
         return max(t, max(ts...));
     }
 
+    // canary for extended alignment support:
+    // over-aligned types like SIMD payloads need at least cache line alignment,
+    // a compiler that silently caps alignas would break the storage guarantee below
+    struct alignas(64) extended_alignment_canary
+    {};
+    static_assert(alignof(extended_alignment_canary) == 64,
+                  "compiler does not support extended alignment up to a cache line");
+
     template <typename... Types>
     class aligned_union
     {
@@ -42,6 +50,9 @@ namespace detail
         static constexpr auto size_value      = detail::max(sizeof(Types)...);
         static constexpr auto alignment_value = detail::max(alignof(Types)...);
 
+        static_assert((alignment_value & (alignment_value - 1)) == 0,
+                      "alignment must be a power of two");
+
         void* get() noexcept
         {
             return &storage_;
@@ -52,6 +63,8 @@ namespace detail
         }
 
     private:
+        // alignas honors the extended alignment of over-aligned members,
+        // so the storage is suitable for aligned loads of the stored type
         alignas(alignment_value) unsigned char storage_[size_value];
     };
 } // namespace detail
@@ -5,9 +5,16 @@
 #ifndef TYPE_SAFE_DETAIL_ASSERT_HPP_INCLUDED
 #define TYPE_SAFE_DETAIL_ASSERT_HPP_INCLUDED
 
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <type_traits>
+#endif
+
 #include <debug_assert.hpp>
 
 #include <type_safe/config.hpp>
+#include <type_safe/violation_handler.hpp>
 
 namespace type_safe
 {
@@ -28,7 +35,85 @@ namespace detail
         {};
         DEBUG_UNREACHABLE(handler{}, "attempt to throw an exception but exceptions are disabled");
     }
+
+    // The kind of check a handler guards, reported to the installed violation handler.
+    template <class Handler>
+    struct violation_kind_of : std::integral_constant<violation_kind, violation_kind::assertion>
+    {};
+
+    template <>
+    struct violation_kind_of<precondition_error_handler>
+    : std::integral_constant<violation_kind, violation_kind::precondition>
+    {};
+
+    constexpr const char* violation_message() noexcept
+    {
+        return nullptr;
+    }
+
+    constexpr const char* violation_message(const char* message) noexcept
+    {
+        return message;
+    }
+
+    // Invoked when a check failed.
+    // Consults the installed violation handler first;
+    // without one, or when it requests termination,
+    // the behavior is exactly that of debug_assert: the handler prints and the process aborts.
+    template <class Handler, typename... Args>
+    debug_assert::detail::regular_void violation_failed(const debug_assert::source_location& loc,
+                                                        const char* expression, Args&&... args)
+    {
+        return on_violation(violation_kind_of<Handler>::value, loc, expression,
+                            violation_message(args...))
+                   ? debug_assert::detail::regular_void()
+                   : (Handler::handle(loc, expression, debug_assert::detail::forward<Args>(args)...),
+                      std::abort(), debug_assert::detail::regular_void());
+    }
+
+    // Mirrors debug_assert::detail::do_assert,
+    // except that the failure path goes through violation_failed().
+    // The passing path generates the same code: the check and a predicted-not-taken branch.
+    template <class Expr, class Handler, typename... Args>
+    DEBUG_ASSERT_FORCE_INLINE constexpr auto do_assert(const Expr& expr,
+                                                       const debug_assert::source_location& loc,
+                                                       const char* expression, Handler,
+                                                       Args&&... args) noexcept ->
+        typename std::enable_if<Handler::level != 0,
+                                debug_assert::detail::regular_void>::type
+    {
+        return TYPE_SAFE_LIKELY(expr())
+                   ? debug_assert::detail::regular_void()
+                   : violation_failed<Handler>(loc, expression,
+                                               debug_assert::detail::forward<Args>(args)...);
+    }
+
+    template <class Expr, class Handler, typename... Args>
+    DEBUG_ASSERT_FORCE_INLINE constexpr auto do_assert(const Expr&,
+                                                       const debug_assert::source_location&,
+                                                       const char*, Handler, Args&&...) noexcept ->
+        typename std::enable_if<Handler::level == 0,
+                                debug_assert::detail::regular_void>::type
+    {
+        return debug_assert::detail::regular_void();
+    }
 } // namespace detail
 } // namespace type_safe
 
-#endif // TYPE_SAFE_DETAIL_ASSERT_HPP_INCLUDED`
+// Route the checks of the library headers through the pluggable violation handler.
+// debug_assert's own failure path unconditionally aborts after the handler returns,
+// so continuing after a violation requires intercepting at the macro.
+// Only the library's own checks use this name;
+// the vendored DEBUG_ASSERT keeps its documented behavior for user code,
+// including the level overloads and throwing handlers this expansion does not mirror.
+// DEBUG_UNREACHABLE is deliberately left alone, continuing there would be unsound.
+#ifndef DEBUG_ASSERT_DISABLE
+#    define TYPE_SAFE_DETAIL_ASSERT(Expr, ...)                                                     \
+        static_cast<void>(type_safe::detail::do_assert([&]() noexcept { return Expr; },            \
+                                                       DEBUG_ASSERT_CUR_SOURCE_LOCATION, #Expr,    \
+                                                       __VA_ARGS__))
+#else
+#    define TYPE_SAFE_DETAIL_ASSERT(Expr, ...) DEBUG_ASSERT(Expr, __VA_ARGS__)
+#endif
+
+#endif // TYPE_SAFE_DETAIL_ASSERT_HPP_INCLUDED
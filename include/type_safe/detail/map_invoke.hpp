@@ -34,6 +34,43 @@ namespace detail
     {
         return (std::forward<Value>(v).*std::forward<Func>(f))(std::forward<Args>(args)...);
     }
+
+    // Invokes a chain of callables on a value,
+    // each one receiving the result of the previous one.
+    template <typename Value, typename... Funcs>
+    struct pipe_invoker;
+
+    template <typename Value, typename Func>
+    struct pipe_invoker<Value, Func>
+    {
+        using type = decltype(map_invoke(std::declval<Func>(), std::declval<Value>()));
+
+        static type invoke(Value&& v, Func&& f)
+        {
+            return map_invoke(std::forward<Func>(f), std::forward<Value>(v));
+        }
+    };
+
+    template <typename Value, typename Func, typename... Rest>
+    struct pipe_invoker<Value, Func, Rest...>
+    {
+        using head = decltype(map_invoke(std::declval<Func>(), std::declval<Value>()));
+        using tail = pipe_invoker<head, Rest...>;
+        using type = typename tail::type;
+
+        static type invoke(Value&& v, Func&& f, Rest&&... rest)
+        {
+            return tail::invoke(map_invoke(std::forward<Func>(f), std::forward<Value>(v)),
+                                std::forward<Rest>(rest)...);
+        }
+    };
+
+    template <typename Value, typename... Funcs>
+    typename pipe_invoker<Value&&, Funcs&&...>::type pipe_invoke(Value&& v, Funcs&&... fs)
+    {
+        return pipe_invoker<Value&&, Funcs&&...>::invoke(std::forward<Value>(v),
+                                                         std::forward<Funcs>(fs)...);
+    }
 } // namespace detail
 } // namespace type_safe
 
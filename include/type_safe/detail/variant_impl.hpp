@@ -44,6 +44,7 @@ namespace detail
                                                     : true)...>;
         using nothrow_swappable
             = all_of<nothrow_move_constructible::value, is_nothrow_swappable<Types>::value...>;
+        using trivially_copyable = is_trivial_union<Types...>;
     };
 
     template <typename... Types>
@@ -136,7 +137,7 @@ namespace detail
             void operator()(T&, Union& a, Union& b)
             {
                 constexpr auto id = typename Union::type_id(union_type<T>{});
-                DEBUG_ASSERT(a.type() == id, detail::assert_handler{});
+                TYPE_SAFE_DETAIL_ASSERT(a.type() == id, detail::assert_handler{});
 
                 if (b.type() == id)
                 {
@@ -194,14 +195,14 @@ namespace detail
         template <typename... Args>
         static void map(Union& res, const Union& u, Functor&& f, Args&&... args)
         {
-            DEBUG_ASSERT(!res.has_value(), precondition_error_handler{});
+            TYPE_SAFE_DETAIL_ASSERT(!res.has_value(), precondition_error_handler{});
             with(u, visitor{}, res, std::forward<Functor>(f), std::forward<Args>(args)...);
         }
 
         template <typename... Args>
         static void map(Union& res, Union&& u, Functor&& f, Args&&... args)
         {
-            DEBUG_ASSERT(!res.has_value(), precondition_error_handler{});
+            TYPE_SAFE_DETAIL_ASSERT(!res.has_value(), precondition_error_handler{});
             with(std::move(u), visitor{}, res, std::forward<Functor>(f),
                  std::forward<Args>(args)...);
         }
@@ -258,30 +259,34 @@ namespace detail
     };
 
     //=== variant_storage ===//
+    template <bool Trivial, class VariantPolicy, typename... Types>
+    class variant_storage_impl;
+
     template <class VariantPolicy, typename... Types>
-    class variant_storage
+    class variant_storage_impl<false, VariantPolicy, Types...>
     {
         using traits = detail::traits<Types...>;
 
     public:
-        variant_storage() noexcept = default;
+        variant_storage_impl() noexcept = default;
 
-        variant_storage(const variant_storage& other)
+        variant_storage_impl(const variant_storage_impl& other)
         {
             copy(storage_, other.storage_);
         }
 
-        variant_storage(variant_storage&& other) noexcept(traits::nothrow_move_constructible::value)
+        variant_storage_impl(variant_storage_impl&& other) noexcept(
+            traits::nothrow_move_constructible::value)
         {
             move(storage_, std::move(other.storage_));
         }
 
-        ~variant_storage() noexcept
+        ~variant_storage_impl() noexcept
         {
             destroy(storage_);
         }
 
-        variant_storage& operator=(const variant_storage& other)
+        variant_storage_impl& operator=(const variant_storage_impl& other)
         {
             if (storage_.has_value() && other.storage_.has_value())
                 copy_assign_union_value<VariantPolicy,
@@ -294,7 +299,7 @@ namespace detail
             return *this;
         }
 
-        variant_storage& operator=(variant_storage&& other) noexcept(
+        variant_storage_impl& operator=(variant_storage_impl&& other) noexcept(
             traits::nothrow_move_assignable::value)
         {
             if (storage_.has_value() && other.storage_.has_value())
@@ -323,6 +328,31 @@ namespace detail
         tagged_union<Types...> storage_;
     };
 
+    // all types are trivially copyable, so the union is as well
+    // and the defaulted special members simply copy the bytes
+    template <class VariantPolicy, typename... Types>
+    class variant_storage_impl<true, VariantPolicy, Types...>
+    {
+    public:
+        tagged_union<Types...>& get_union() noexcept
+        {
+            return storage_;
+        }
+
+        const tagged_union<Types...>& get_union() const noexcept
+        {
+            return storage_;
+        }
+
+    private:
+        tagged_union<Types...> storage_;
+    };
+
+    template <class VariantPolicy, typename... Types>
+    using variant_storage
+        = variant_storage_impl<traits<Types...>::trivially_copyable::value, VariantPolicy,
+                               Types...>;
+
     struct storage_access
     {
         template <class Variant>
@@ -0,0 +1,221 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_DIVIDER_HPP_INCLUDED
+#define TYPE_SAFE_DIVIDER_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstdint>
+#    include <limits>
+#    include <type_traits>
+#endif
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/detail/force_inline.hpp>
+#include <type_safe/integer.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    // The upper half of the full product of two unsigned values.
+    template <typename T,
+              typename = typename std::enable_if<sizeof(T) < sizeof(std::uint64_t)>::type>
+    TYPE_SAFE_FORCE_INLINE constexpr T unsigned_mulhi(T a, T b) noexcept
+    {
+        return T((std::uint64_t(a) * std::uint64_t(b)) >> (sizeof(T) * 8));
+    }
+
+#if defined(__SIZEOF_INT128__)
+    TYPE_SAFE_FORCE_INLINE constexpr std::uint64_t unsigned_mulhi(std::uint64_t a,
+                                                                  std::uint64_t b) noexcept
+    {
+        return std::uint64_t((unsigned __int128)(a) * (unsigned __int128)(b) >> 64);
+    }
+#else
+    inline TYPE_SAFE_CONSTEXPR14 std::uint64_t unsigned_mulhi(std::uint64_t a,
+                                                              std::uint64_t b) noexcept
+    {
+        auto a_lo = a & 0xFFFFFFFFu;
+        auto a_hi = a >> 32;
+        auto b_lo = b & 0xFFFFFFFFu;
+        auto b_hi = b >> 32;
+
+        auto lo_lo = a_lo * b_lo;
+        auto hi_lo = a_hi * b_lo;
+        auto lo_hi = a_lo * b_hi;
+        auto hi_hi = a_hi * b_hi;
+
+        auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi;
+        return hi_hi + (hi_lo >> 32) + (cross >> 32);
+    }
+#endif
+
+    // The magic number, shift and rounding mode of the multiply + shift sequence
+    // that divides by a fixed divisor; algorithm of Granlund & Montgomery
+    // as popularized by libdivide.
+    template <typename UIntT>
+    struct udiv_magic
+    {
+        UIntT magic; // 0 for a power of two divisor
+        int   shift;
+        bool  add;
+    };
+
+    template <typename UIntT>
+    TYPE_SAFE_CONSTEXPR14 udiv_magic<UIntT> make_udiv_magic(UIntT d) noexcept
+    {
+        constexpr auto bits = int(sizeof(UIntT) * 8);
+
+        auto floor_log_2 = 0;
+        for (auto tmp = d; tmp >>= 1;)
+            ++floor_log_2;
+
+        if ((d & UIntT(d - UIntT(1))) == UIntT(0))
+            // power of two, a plain shift suffices
+            return {UIntT(0), floor_log_2, false};
+
+        // long division of 2^(bits + floor_log_2) by d,
+        // using only single width arithmetic
+        UIntT quot = UIntT(0), rem = UIntT(0);
+        for (auto i = bits + floor_log_2; i >= 0; --i)
+        {
+            auto high = (rem >> (bits - 1)) != UIntT(0);
+            rem       = UIntT(UIntT(rem << 1) | UIntT(i == bits + floor_log_2 ? 1 : 0));
+            quot      = UIntT(quot << 1);
+            if (high || rem >= d)
+            {
+                rem = UIntT(rem - d);
+                quot |= UIntT(1);
+            }
+        }
+
+        auto e = UIntT(d - rem);
+        if (e < UIntT(UIntT(1) << floor_log_2))
+            // the magic number fits into the type
+            return {UIntT(quot + UIntT(1)), floor_log_2, false};
+
+        // the magic number needs one bit more,
+        // the runtime sequence has to add the numerator back in
+        auto twice_quot = UIntT(quot + quot);
+        auto twice_rem  = UIntT(rem + rem);
+        if (twice_rem >= d || twice_rem < rem)
+            twice_quot = UIntT(twice_quot + UIntT(1));
+        return {UIntT(twice_quot + UIntT(1)), floor_log_2, true};
+    }
+
+    template <typename UIntT>
+    TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 UIntT do_udiv_magic(const udiv_magic<UIntT>& m,
+                                                                     UIntT n) noexcept
+    {
+        if (m.magic == UIntT(0))
+            return UIntT(n >> m.shift);
+
+        auto q = unsigned_mulhi(m.magic, n);
+        if (m.add)
+            q = UIntT(UIntT(UIntT(n - q) >> 1) + q);
+        return UIntT(q >> m.shift);
+    }
+} // namespace detail
+
+/// A fixed divisor whose reciprocal "magic number" is precomputed at construction,
+/// so every division becomes a multiply + shift.
+///
+/// This pays off whenever many values are divided by the same runtime divisor,
+/// e.g. in bucketing or hashing loops;
+/// for a compile-time divisor the construction itself can be `constexpr`.
+/// The division by zero precondition of the arithmetic policies is hoisted
+/// to construction time.
+/// \requires `IntegerT` must be an integral type except `bool` and `char`.
+/// \module types
+template <typename IntegerT>
+class divider
+{
+    static_assert(detail::is_integer<IntegerT>::value, "must be a real integer type");
+
+public:
+    using integer_type = IntegerT;
+
+    /// \effects Precomputes the magic number for the divisor `d`.
+    /// \requires `d != 0`.
+    /// \group constructor
+    explicit TYPE_SAFE_CONSTEXPR14 divider(integer_type d)
+    : magic_(detail::make_udiv_magic(to_unsigned(d))), divisor_(d)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(d != integer_type(0), detail::precondition_error_handler{},
+                                "division by zero");
+    }
+
+    /// \group constructor
+    /// \param 1
+    /// \exclude
+    template <class Policy>
+    explicit TYPE_SAFE_CONSTEXPR14 divider(const integer<IntegerT, Policy>& d)
+    : divider(static_cast<IntegerT>(d))
+    {}
+
+    /// \returns The divisor it was created with.
+    TYPE_SAFE_FORCE_INLINE constexpr integer_type divisor() const noexcept
+    {
+        return divisor_;
+    }
+
+    /// \returns The quotient `n / divisor()`, truncated towards zero
+    /// like the built-in division.
+    /// \requires If `IntegerT` is signed and `divisor()` is `-1`,
+    /// `n` must not be the minimum value.
+    TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 integer_type divide(integer_type n) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!std::is_signed<IntegerT>::value || divisor_ != integer_type(-1)
+                                || n != std::numeric_limits<integer_type>::min(),
+                                detail::precondition_error_handler{}, "division will result in overflow");
+        auto uq = detail::do_udiv_magic(magic_, to_unsigned(n));
+        return is_negative(n) != is_negative(divisor_)
+                   ? integer_type(unsigned_type(unsigned_type(0) - uq))
+                   : integer_type(uq);
+    }
+
+private:
+    using unsigned_type = typename std::make_unsigned<IntegerT>::type;
+
+    static constexpr bool is_negative(integer_type val) noexcept
+    {
+        return std::is_signed<IntegerT>::value && val < integer_type(0);
+    }
+
+    static constexpr unsigned_type to_unsigned(integer_type val) noexcept
+    {
+        return is_negative(val) ? unsigned_type(unsigned_type(0) - unsigned_type(val))
+                                : unsigned_type(val);
+    }
+
+    detail::udiv_magic<unsigned_type> magic_;
+    integer_type                      divisor_;
+};
+
+/// \returns The quotient of the stored integer value and the precomputed divisor,
+/// i.e. `d.divide(n)`.
+/// \module types
+/// \group divider_div Division by a divider
+template <typename T, class Policy>
+TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 integer<T, Policy> operator/(
+    const integer<T, Policy>& n, const divider<T>& d) noexcept
+{
+    return integer<T, Policy>(d.divide(static_cast<T>(n)));
+}
+
+/// \group divider_div
+/// \param 1
+/// \exclude
+template <typename T, typename = typename std::enable_if<detail::is_integer<T>::value>::type>
+TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 T operator/(const T& n, const divider<T>& d) noexcept
+{
+    return d.divide(n);
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_DIVIDER_HPP_INCLUDED
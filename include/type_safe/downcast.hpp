@@ -8,7 +8,9 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <cstddef>
 #include <type_traits>
+#include <typeinfo>
 #endif
 
 #include <type_safe/config.hpp>
@@ -23,8 +25,68 @@ template <typename T>
 struct derived_type
 {};
 
+/// Customization point to register the derived classes of a base class.
+///
+/// Specialize it for your own base class and provide two members:
+/// a `static std::size_t kind(const Base& obj)` returning a per-object discriminant,
+/// and a `template <typename Derived> static constexpr std::size_t kind_of()`
+/// returning the discriminant all objects of dynamic type `Derived` have.
+/// [ts::downcast]() will then verify by comparing the two integers instead of using RTTI,
+/// [ts::derived_kinds]() implements `kind_of()` for the common case of a type list.
+template <typename Base>
+struct known_derived_types
+{};
+
+/// \exclude
+namespace detail
+{
+    template <typename T, typename... Types>
+    struct index_of;
+
+    template <typename T, typename... Tail>
+    struct index_of<T, T, Tail...> : std::integral_constant<std::size_t, 0u>
+    {};
+
+    template <typename T, typename Head, typename... Tail>
+    struct index_of<T, Head, Tail...>
+    : std::integral_constant<std::size_t, 1u + index_of<T, Tail...>::value>
+    {};
+} // namespace detail
+
+/// Convenience base for specializations of [ts::known_derived_types]().
+///
+/// It implements `kind_of()` as the position of the derived class in the given type list,
+/// the specialization only needs to provide the matching `kind()` function.
+template <class... Types>
+struct derived_kinds
+{
+    /// \returns The discriminant of `Derived`, i.e. its index in `Types`.
+    template <typename Derived>
+    static constexpr std::size_t kind_of() noexcept
+    {
+        return detail::index_of<Derived, Types...>::value;
+    }
+};
+
 namespace detail
 {
+    template <typename Base, typename = void>
+    struct has_known_derived_types : std::false_type
+    {};
+
+    template <typename Base>
+    struct has_known_derived_types<Base, decltype(void(known_derived_types<Base>::kind(
+                                             std::declval<const Base&>())))> : std::true_type
+    {};
+
+#if TYPE_SAFE_USE_IS_FINAL
+    template <typename T>
+    using is_final = std::is_final<T>;
+#else
+    template <typename T>
+    using is_final = std::false_type;
+#endif
+
     // same type
     template <typename T>
     bool is_safe_downcast(derived_type<T>, const T&)
@@ -32,10 +94,38 @@ namespace detail
         return true;
     }
 
+    // registered derived types, compare the stored kind instead of using RTTI
+    template <typename Derived, typename Base>
+    auto is_safe_downcast(derived_type<Derived>, const Base& obj) ->
+        typename std::enable_if<has_known_derived_types<Base>::value, bool>::type
+    {
+        return known_derived_types<Base>::kind(obj)
+               == known_derived_types<Base>::template kind_of<Derived>();
+    }
+
+    // a final class can only be the most derived type,
+    // so an exact type comparison suffices instead of a full dynamic_cast
+    template <typename Derived, typename Base>
+    auto is_safe_downcast(derived_type<Derived>, const Base& obj) ->
+        typename std::enable_if<!has_known_derived_types<Base>::value
+                                    && std::is_polymorphic<Base>::value
+                                    && is_final<Derived>::value,
+                                bool>::type
+    {
+#if TYPE_SAFE_USE_RTTI
+        return typeid(obj) == typeid(Derived);
+#else
+        return true;
+#endif
+    }
+
     // polymorphic type, so we can check
     template <typename Derived, typename Base>
     auto is_safe_downcast(derived_type<Derived>, const Base& obj) ->
-        typename std::enable_if<std::is_polymorphic<Base>::value, bool>::type
+        typename std::enable_if<!has_known_derived_types<Base>::value
+                                    && std::is_polymorphic<Base>::value
+                                    && !is_final<Derived>::value,
+                                bool>::type
     {
 #if TYPE_SAFE_USE_RTTI
         return dynamic_cast<const Derived*>(&obj) != nullptr;
@@ -47,7 +137,9 @@ namespace detail
     // non-polymorphic type, no check possible
     template <typename Derived, typename Base>
     auto is_safe_downcast(derived_type<Derived>, const Base&) ->
-        typename std::enable_if<!std::is_polymorphic<Base>::value, bool>::type
+        typename std::enable_if<!has_known_derived_types<Base>::value
+                                    && !std::is_polymorphic<Base>::value,
+                                bool>::type
     {
         return true;
     }
@@ -58,8 +150,8 @@ namespace detail
         using derived_t = typename std::decay<Derived>::type;
         static_assert(std::is_base_of<Base, derived_t>::value,
                       "can only downcast from base to derived class");
-        DEBUG_ASSERT(detail::is_safe_downcast(derived_type<derived_t>{}, obj),
-                     detail::precondition_error_handler{}, "not a safe downcast");
+        TYPE_SAFE_DETAIL_ASSERT(detail::is_safe_downcast(derived_type<derived_t>{}, obj),
+                                detail::precondition_error_handler{}, "not a safe downcast");
     }
 } // namespace detail
 
@@ -94,6 +186,36 @@ const Derived& downcast(derived_type<Derived>, const Base& obj) noexcept
     detail::validate_downcast<Derived>(obj);
     return static_cast<const Derived&>(obj);
 }
+
+/// Downcasts a homogeneous run of objects at once.
+///
+/// \effects Invokes `f` with every object converted to `Derived&`, in order.
+/// Only the first object of the run is verified like [ts::downcast]() does,
+/// the remaining objects are cast unchecked.
+/// \requires `Base` must be a base class of `Derived`,
+/// all pointers must be valid,
+/// and every object of the run must have the same dynamic type.
+/// \group downcast_batch
+template <typename Derived, typename Base, typename Func>
+void downcast_batch(Base* const* objects, std::size_t size, Func f)
+{
+    if (size == 0u)
+        return;
+    detail::validate_downcast<Derived&>(*objects[0]);
+    for (std::size_t i = 0u; i != size; ++i)
+        f(static_cast<Derived&>(*objects[i]));
+}
+
+/// \group downcast_batch
+template <typename Derived, typename Base, typename Func>
+void downcast_batch(const Base* const* objects, std::size_t size, Func f)
+{
+    if (size == 0u)
+        return;
+    detail::validate_downcast<const Derived&>(*objects[0]);
+    for (std::size_t i = 0u; i != size; ++i)
+        f(static_cast<const Derived&>(*objects[i]));
+}
 } // namespace type_safe
 
 #endif // TYPE_SAFE_DOWNCAST_HPP_INCLUDED
@@ -5,6 +5,12 @@
 #ifndef TYPE_SAFE_FLAG_HPP_INCLUDED
 #define TYPE_SAFE_FLAG_HPP_INCLUDED
 
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#include <atomic>
+#endif
+
 #include <type_safe/boolean.hpp>
 #include <type_safe/detail/assert.hpp>
 
@@ -79,7 +85,7 @@ public:
     template <typename T, typename = detail::enable_boolean<T>>
     void change(T new_state) noexcept
     {
-        DEBUG_ASSERT(state_ != new_state, detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(state_ != new_state, detail::precondition_error_handler{});
         state_ = new_state;
     }
 
@@ -181,6 +187,106 @@ constexpr bool operator!=(T lhs, flag rhs) noexcept
 {
     return !(lhs == rhs);
 }
+
+/// A [ts::flag]() that can be changed concurrently from multiple threads.
+///
+/// It provides the same `try_set()`/`try_reset()`/`change()` vocabulary
+/// on top of a [std::atomic]() boolean,
+/// where the try functions are a single atomic exchange,
+/// so the "only do this once" idiom works across threads without a mutex:
+/// ```cpp
+/// type_safe::atomic_flag_t initialized(false);
+/// …
+/// if (initialized.try_set()) // exactly one thread enters
+///     do_initialization();
+/// ```
+/// \notes It is named `atomic_flag_t` as [std::atomic_flag]() already takes the obvious name,
+/// even though this one provides the extended [ts::flag]() interface.
+/// \module types
+class atomic_flag_t
+{
+public:
+    atomic_flag_t() = delete;
+
+    /// \effects Gives the flag the initial state.
+    /// \notes This function does not participate in overload resolution if `T` is not a boolean
+    /// type. \param 1 \exclude
+    template <typename T, typename = detail::enable_boolean<T>>
+    constexpr atomic_flag_t(T initial_state) noexcept : state_(static_cast<bool>(initial_state))
+    {}
+
+    atomic_flag_t(const atomic_flag_t&)            = delete;
+    atomic_flag_t& operator=(const atomic_flag_t&) = delete;
+
+    /// \returns Whether the operations on it are lock-free.
+    bool is_lock_free() const noexcept
+    {
+        return state_.is_lock_free();
+    }
+
+    /// \returns The current state of the flag.
+    bool load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return state_.load(order);
+    }
+
+    /// \effects Atomically flips the state of the flag.
+    /// \returns The old value.
+    bool toggle(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto old = state_.load(std::memory_order_relaxed);
+        while (!state_.compare_exchange_weak(old, !old, order, std::memory_order_relaxed))
+        {}
+        return old;
+    }
+
+    /// \effects Atomically sets its state to the new one.
+    /// \requires The new state must be different than the old one;
+    /// with concurrent writers this can only be guaranteed
+    /// if all of them use the try functions.
+    /// \param 1
+    /// \exclude
+    template <typename T, typename = detail::enable_boolean<T>>
+    void change(T new_state, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto old = state_.exchange(static_cast<bool>(new_state), order);
+        TYPE_SAFE_DETAIL_ASSERT(old != static_cast<bool>(new_state),
+                                detail::precondition_error_handler{});
+    }
+
+    /// \effects Atomically sets its state to `true`.
+    void set(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        state_.store(true, order);
+    }
+
+    /// \effects Atomically sets its state to `true`.
+    /// \returns `true` if the previous state was `false`, `false` otherwise,
+    /// i.e. whether or not the state was changed.
+    /// Exactly one of multiple concurrent callers gets `true`.
+    bool try_set(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return !state_.exchange(true, order);
+    }
+
+    /// \effects Atomically sets its state to `false`.
+    void reset(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        state_.store(false, order);
+    }
+
+    /// \effects Atomically sets its state to `false`.
+    /// \returns `true` if the previous state was `true`, `false` otherwise,
+    /// i.e. whether or not the state was changed.
+    /// Exactly one of multiple concurrent callers gets `true`.
+    bool try_reset(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return state_.exchange(false, order);
+    }
+
+private:
+    std::atomic<bool> state_;
+};
 } // namespace type_safe
 
 #endif // TYPE_SAFE_FLAG_HPP_INCLUDED
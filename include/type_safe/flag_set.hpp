@@ -8,8 +8,11 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <atomic>
 #include <climits>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <type_traits>
 #endif
 
@@ -77,6 +80,128 @@ constexpr noflag_t noflag;
 /// \exclude
 namespace detail
 {
+    // Storage for flag sets with more flags than the largest integer type has bits:
+    // an array of 64-bit words providing the integer operations `flag_set` needs.
+    // All operations are straight word-parallel loops over the array,
+    // which the compiler unrolls and vectorizes for the fixed word count.
+    template <std::size_t Words>
+    struct flag_set_storage
+    {
+        std::uint64_t words[Words];
+
+        constexpr flag_set_storage() noexcept : words{} {}
+
+        TYPE_SAFE_CONSTEXPR14 flag_set_storage(std::uint64_t value) noexcept : words{}
+        {
+            words[0u] = value;
+        }
+
+        TYPE_SAFE_CONSTEXPR14 flag_set_storage operator~() const noexcept
+        {
+            flag_set_storage result;
+            for (std::size_t i = 0u; i != Words; ++i)
+                result.words[i] = ~words[i];
+            return result;
+        }
+
+        TYPE_SAFE_CONSTEXPR14 flag_set_storage operator<<(std::size_t shift) const noexcept
+        {
+            flag_set_storage result;
+            auto word_shift = shift / 64u;
+            auto bit_shift  = shift % 64u;
+            for (auto i = Words; i-- > word_shift;)
+                result.words[i]
+                    = (words[i - word_shift] << bit_shift)
+                      | (bit_shift == 0u || i == word_shift
+                             ? std::uint64_t(0u)
+                             : words[i - word_shift - 1u] >> (64u - bit_shift));
+            return result;
+        }
+
+        friend TYPE_SAFE_CONSTEXPR14 flag_set_storage operator|(const flag_set_storage& a,
+                                                                const flag_set_storage& b) noexcept
+        {
+            flag_set_storage result;
+            for (std::size_t i = 0u; i != Words; ++i)
+                result.words[i] = a.words[i] | b.words[i];
+            return result;
+        }
+
+        friend TYPE_SAFE_CONSTEXPR14 flag_set_storage operator&(const flag_set_storage& a,
+                                                                const flag_set_storage& b) noexcept
+        {
+            flag_set_storage result;
+            for (std::size_t i = 0u; i != Words; ++i)
+                result.words[i] = a.words[i] & b.words[i];
+            return result;
+        }
+
+        friend TYPE_SAFE_CONSTEXPR14 flag_set_storage operator^(const flag_set_storage& a,
+                                                                const flag_set_storage& b) noexcept
+        {
+            flag_set_storage result;
+            for (std::size_t i = 0u; i != Words; ++i)
+                result.words[i] = a.words[i] ^ b.words[i];
+            return result;
+        }
+
+        // only needed for `bits - 1`, but implemented as a full subtraction with borrow
+        friend TYPE_SAFE_CONSTEXPR14 flag_set_storage operator-(const flag_set_storage& a,
+                                                                const flag_set_storage& b) noexcept
+        {
+            flag_set_storage result;
+            auto             borrow = std::uint64_t(0u);
+            for (std::size_t i = 0u; i != Words; ++i)
+            {
+                auto diff       = a.words[i] - b.words[i];
+                auto new_borrow = std::uint64_t(a.words[i] < b.words[i])
+                                  | std::uint64_t(diff < borrow);
+                result.words[i] = diff - borrow;
+                borrow          = new_borrow;
+            }
+            return result;
+        }
+
+        TYPE_SAFE_CONSTEXPR14 flag_set_storage& operator&=(const flag_set_storage& other) noexcept
+        {
+            for (std::size_t i = 0u; i != Words; ++i)
+                words[i] &= other.words[i];
+            return *this;
+        }
+
+        friend TYPE_SAFE_CONSTEXPR14 bool operator==(const flag_set_storage& a,
+                                                     const flag_set_storage& b) noexcept
+        {
+            auto difference = std::uint64_t(0u);
+            for (std::size_t i = 0u; i != Words; ++i)
+                difference |= a.words[i] ^ b.words[i];
+            return difference == 0u;
+        }
+
+        friend TYPE_SAFE_CONSTEXPR14 bool operator!=(const flag_set_storage& a,
+                                                     const flag_set_storage& b) noexcept
+        {
+            return !(a == b);
+        }
+
+        explicit TYPE_SAFE_CONSTEXPR14 operator bool() const noexcept
+        {
+            auto any = std::uint64_t(0u);
+            for (std::size_t i = 0u; i != Words; ++i)
+                any |= words[i];
+            return any != 0u;
+        }
+    };
+
+    template <std::size_t Words>
+    TYPE_SAFE_CONSTEXPR14 int countr_zero_impl(const flag_set_storage<Words>& storage) noexcept
+    {
+        for (std::size_t i = 0u; i != Words; ++i)
+            if (storage.words[i] != 0u)
+                return int(i * 64u) + countr_zero_impl(storage.words[i]);
+        return int(Words * 64u);
+    }
+
     template <std::size_t Size, typename = void>
     struct select_flag_set_int
     {
@@ -99,6 +224,14 @@ namespace detail
 
 #undef TYPE_SAFE_DETAIL_SELECT
 
+    // more flags than the largest integer type has bits: use an array of words
+    template <std::size_t Size>
+    struct select_flag_set_int<
+        Size, typename std::enable_if<(Size > sizeof(std::uint_least64_t) * CHAR_BIT)>::type>
+    {
+        using type = flag_set_storage<(Size + 63u) / 64u>;
+    };
+
     template <typename Enum, typename Tag = void>
     class flag_set_impl
     {
@@ -412,6 +545,12 @@ constexpr flag_mask<Enum> mask(const flag_combo<Enum>& combo) noexcept
 /// which can be set, cleared or toggled.
 /// It can be interpreted as either a flag combination or flag mask, however.
 ///
+/// The flags are stored in the smallest unsigned integer type with enough bits;
+/// an enum with more flags than the largest integer type has bits
+/// uses an array of 64-bit words instead,
+/// with all set operations and queries running word-parallel over the array.
+/// `to_int()` is only available for the single integer representation.
+///
 /// \requires `Enum` must be a flag,
 /// i.e. valid with the [ts::flag_set_traits]().
 template <typename Enum>
@@ -549,6 +688,88 @@ public:
         return is_set(flag);
     }
 
+    //=== iteration ===//
+    /// A forward iterator over the flags that are set.
+    ///
+    /// It yields every `Enum` whose flag is set, in order of increasing bit index.
+    /// Finding the next flag is a single count-trailing-zeros operation
+    /// on a copy of the bits where advancing clears the lowest set bit,
+    /// so visiting `k` set flags costs `k` operations instead of one check per bit.
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Enum;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Enum*;
+        using reference         = Enum;
+
+        /// \effects Creates the past-the-end iterator.
+        constexpr iterator() noexcept : bits_(int_type(0u)) {}
+
+        /// \returns The flag of the lowest set bit.
+        /// \requires The iterator must not be the past-the-end iterator.
+        TYPE_SAFE_CONSTEXPR14 Enum operator*() const noexcept
+        {
+            return static_cast<Enum>(detail::countr_zero_impl(bits_));
+        }
+
+        /// \effects Clears the lowest set bit.
+        /// \group increment
+        TYPE_SAFE_CONSTEXPR14 iterator& operator++() noexcept
+        {
+            bits_ &= int_type(bits_ - int_type(1u));
+            return *this;
+        }
+
+        /// \group increment
+        TYPE_SAFE_CONSTEXPR14 iterator operator++(int) noexcept
+        {
+            auto save = *this;
+            ++*this;
+            return save;
+        }
+
+        friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept
+        {
+            return a.bits_ == b.bits_;
+        }
+
+        friend constexpr bool operator!=(const iterator& a, const iterator& b) noexcept
+        {
+            return !(a == b);
+        }
+
+    private:
+        explicit constexpr iterator(int_type bits) noexcept : bits_(bits) {}
+
+        int_type bits_;
+
+        friend flag_set;
+    };
+
+    /// \returns An iterator to the first set flag (1)/the past-the-end iterator (2).
+    /// \group iteration
+    constexpr iterator begin() const noexcept
+    {
+        return iterator(flags_.to_int());
+    }
+
+    /// \group iteration
+    constexpr iterator end() const noexcept
+    {
+        return iterator();
+    }
+
+    /// \effects Invokes `f` with every flag that is set,
+    /// in order of increasing bit index.
+    template <typename Func>
+    void for_each_set(Func f) const
+    {
+        for (auto flag : *this)
+            f(flag);
+    }
+
     //=== accessors ===//
     /// \returns Whether any flag is set.
     constexpr bool any() const noexcept
@@ -788,6 +1009,216 @@ constexpr bool operator&(const FlagCombo& a, const flag_set<Enum>& b)
 {
     return b & a;
 }
+
+/// A [ts::flag_set]() whose flags can be mutated concurrently from multiple threads.
+///
+/// The flags are stored in a single [std::atomic]() integer,
+/// so every mutation is one atomic read-modify-write instruction
+/// (`lock or`/`lock and`/`lock xor`) and no external mutex is needed.
+/// It supports the same flag operations as [ts::flag_set](),
+/// including combo and mask operations,
+/// but as it cannot be copied, reading the flags is done via [*load]()
+/// which returns a snapshot as a regular [ts::flag_set]().
+///
+/// \requires `Enum` must be a flag,
+/// i.e. valid with the [ts::flag_set_traits]().
+template <typename Enum>
+class atomic_flag_set
+{
+    static_assert(std::is_enum<Enum>::value, "not an enum");
+    static_assert(flag_set_traits<Enum>::value, "invalid enum for atomic_flag_set");
+
+public:
+    using int_type = typename detail::flag_set_impl<Enum>::int_type;
+
+    //=== constructors/assignment ===//
+    /// \effects Creates a set where all flags are set to `0`.
+    /// \group ctor_null
+    atomic_flag_set() noexcept : bits_(int_type(0u)) {}
+
+    /// \group ctor_null
+    atomic_flag_set(noflag_t) noexcept : atomic_flag_set() {}
+
+    /// \effects Creates a set where all bits are set to `0` except the given ones.
+    /// \notes This constructor only participates in overload resolution
+    /// if the argument is a flag combination.
+    template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+    atomic_flag_set(const FlagCombo& combo) noexcept
+    : bits_(detail::flag_set_impl<Enum>(combo).to_int())
+    {}
+
+    atomic_flag_set(const atomic_flag_set&)            = delete;
+    atomic_flag_set& operator=(const atomic_flag_set&) = delete;
+
+    /// \returns Whether the operations on it are lock-free.
+    bool is_lock_free() const noexcept
+    {
+        return bits_.is_lock_free();
+    }
+
+    //=== flag operation ===//
+    /// \effects Atomically sets the specified flag to `1` (1)/`value` (2/3).
+    /// \notes (2) does not participate in overload resolution unless `T` is a boolean-like type.
+    /// \group set
+    void set(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.fetch_or(detail::flag_set_impl<Enum>(flag).to_int(), order);
+    }
+
+    /// \group set
+    /// \param 1
+    /// \exclude
+    template <typename T, typename = detail::enable_boolean<T>>
+    void set(const Enum& flag, T value,
+             std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        if (value)
+            set(flag, order);
+        else
+            reset(flag, order);
+    }
+
+    /// \group set
+    void set(const Enum& f, flag value,
+             std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        set(f, value == true, order);
+    }
+
+    /// \effects Atomically sets the specified flag to `0`.
+    void reset(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.fetch_and(int_type(~detail::flag_set_impl<Enum>(flag).to_int()), order);
+    }
+
+    /// \effects Atomically toggles the specified flag.
+    void toggle(const Enum& flag, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.fetch_xor(detail::flag_set_impl<Enum>(flag).to_int(), order);
+    }
+
+    /// \effects Atomically sets/resets/toggles all flags.
+    /// \group all
+    void set_all(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.fetch_or(detail::flag_set_impl<Enum>::all_set().to_int(), order);
+    }
+
+    /// \group all
+    void reset_all(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.store(int_type(0u), order);
+    }
+
+    /// \group all
+    void toggle_all(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.fetch_xor(detail::flag_set_impl<Enum>::all_set().to_int(), order);
+    }
+
+    /// \returns Whether or not the specified flag is set.
+    bool is_set(const Enum& flag,
+                std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return (bits_.load(order) & detail::flag_set_impl<Enum>(flag).to_int()) != int_type(0u);
+    }
+
+    /// \returns Same as `flag(is_set(flag))`.
+    flag as_flag(const Enum& flag,
+                 std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return is_set(flag, order);
+    }
+
+    //=== snapshot ===//
+    /// \returns A snapshot of the current flags as a [ts::flag_set]().
+    /// \notes The snapshot is consistent — all flags were set like that at one point in time —
+    /// but other threads may change the flags immediately afterwards.
+    flag_set<Enum> load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return flag_set<Enum>::from_int(bits_.load(order));
+    }
+
+    /// \effects Atomically replaces all flags with the ones of the given set.
+    void store(const flag_set<Enum>& set,
+               std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        bits_.store(set.template to_int<int_type>(), order);
+    }
+
+    /// \effects Atomically replaces all flags with the ones of the given set.
+    /// \returns The previous flags as a [ts::flag_set]().
+    flag_set<Enum> exchange(const flag_set<Enum>& set,
+                            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return flag_set<Enum>::from_int(bits_.exchange(set.template to_int<int_type>(), order));
+    }
+
+    /// \effects Atomically compares the flags to `expected`
+    /// and replaces them with `desired` if they are equal,
+    /// otherwise updates `expected` with the current flags.
+    /// \returns Whether the transition happened.
+    /// \notes This is a single compare-exchange on the entire state word,
+    /// so a state machine transition like "connected → closing" cannot race
+    /// with a concurrent transition away from "connected".
+    /// \group try_transition
+    bool try_transition(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                        std::memory_order success, std::memory_order failure) noexcept
+    {
+        auto raw    = expected.template to_int<int_type>();
+        auto result = bits_.compare_exchange_strong(raw, desired.template to_int<int_type>(),
+                                                    success, failure);
+        if (!result)
+            expected = flag_set<Enum>::from_int(raw);
+        return result;
+    }
+
+    /// \group try_transition
+    bool try_transition(flag_set<Enum>& expected, const flag_set<Enum>& desired,
+                        std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto raw    = expected.template to_int<int_type>();
+        auto result = bits_.compare_exchange_strong(raw, desired.template to_int<int_type>(),
+                                                    order);
+        if (!result)
+            expected = flag_set<Enum>::from_int(raw);
+        return result;
+    }
+
+    //=== bitwise operations ===//
+    /// \effects Atomically sets all flags that are set in the given flag combination.
+    /// \returns `*this`
+    /// \notes This operator does not participate in overload resolution,
+    /// unless the argument is a flag combination.
+    template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+    atomic_flag_set& operator|=(const FlagCombo& other) noexcept
+    {
+        bits_.fetch_or(detail::flag_set_impl<Enum>(other).to_int());
+        return *this;
+    }
+
+    /// \effects Atomically toggles all flags that are set in the given flag combination.
+    /// \returns `*this`
+    /// \notes This operator does not participate in overload resolution,
+    /// unless the argument is a flag combination.
+    template <typename FlagCombo, typename = detail::enable_flag_combo<FlagCombo, Enum>>
+    atomic_flag_set& operator^=(const FlagCombo& other) noexcept
+    {
+        bits_.fetch_xor(detail::flag_set_impl<Enum>(other).to_int());
+        return *this;
+    }
+
+    /// \effects Atomically clears all flags that aren't set in the given flag mask.
+    /// \returns `*this`
+    atomic_flag_set& operator&=(const flag_mask<Enum>& other) noexcept
+    {
+        bits_.fetch_and(detail::flag_set_impl<Enum>(other).to_int());
+        return *this;
+    }
+
+private:
+    std::atomic<int_type> bits_;
+};
 } // namespace type_safe
 
 /// Creates a [ts::flag_mask]() for the single enum value.
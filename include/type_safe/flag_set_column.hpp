@@ -0,0 +1,312 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_FLAG_SET_COLUMN_HPP_INCLUDED
+#define TYPE_SAFE_FLAG_SET_COLUMN_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#endif
+
+#include <type_safe/flag_set.hpp>
+#include <type_safe/integer.hpp>
+
+namespace type_safe
+{
+/// A collection of flags for many rows in bit-sliced layout.
+///
+/// Unlike a `std::vector<ts::flag_set<Enum>>`, which interleaves the flags of a row,
+/// this container stores one packed bitmap per flag.
+/// A column-wise query like "all rows with the dirty flag" then reads
+/// one contiguous bitmap instead of striding over every row,
+/// counting matches is a popcount loop,
+/// and combining columns is a word-wise loop the compiler can vectorize.
+///
+/// \requires `Enum` must be a flag,
+/// i.e. valid with the [ts::flag_set_traits]().
+template <typename Enum>
+class flag_set_column
+{
+    static_assert(std::is_enum<Enum>::value, "not an enum");
+    static_assert(flag_set_traits<Enum>::value, "invalid enum for flag_set_column");
+
+public:
+    using size_type = std::size_t;
+
+    /// A packed bitmap over the rows, the result of a column query.
+    ///
+    /// Masks of the same container can be combined word-wise
+    /// and the matching rows visited with one count-trailing-zeros per match.
+    class row_mask
+    {
+    public:
+        /// \returns A mask where a row is set if it is set in both (1)/either (2) mask,
+        /// or set in `*this` but not in `other` (3).
+        /// \requires Both masks must come from the same container.
+        /// \group bitwise
+        row_mask bitwise_and(const row_mask& other) const
+        {
+            TYPE_SAFE_DETAIL_ASSERT(words_.size() == other.words_.size(),
+                                    detail::precondition_error_handler{});
+            auto result = *this;
+            for (size_type w = 0u; w != words_.size(); ++w)
+                result.words_[w] &= other.words_[w];
+            return result;
+        }
+
+        /// \group bitwise
+        row_mask bitwise_or(const row_mask& other) const
+        {
+            TYPE_SAFE_DETAIL_ASSERT(words_.size() == other.words_.size(),
+                                    detail::precondition_error_handler{});
+            auto result = *this;
+            for (size_type w = 0u; w != words_.size(); ++w)
+                result.words_[w] |= other.words_[w];
+            return result;
+        }
+
+        /// \group bitwise
+        row_mask and_not(const row_mask& other) const
+        {
+            TYPE_SAFE_DETAIL_ASSERT(words_.size() == other.words_.size(),
+                                    detail::precondition_error_handler{});
+            auto result = *this;
+            for (size_type w = 0u; w != words_.size(); ++w)
+                result.words_[w] &= ~other.words_[w];
+            return result;
+        }
+
+        /// \returns Whether the given row is set in the mask.
+        bool is_set(size_type row) const noexcept
+        {
+            return (words_[row / bits_per_word]
+                    & (std::uint64_t(1) << (row % bits_per_word)))
+                   != 0u;
+        }
+
+        /// \returns The number of rows that are set,
+        /// computed as a popcount over the bitmap.
+        size_type count() const noexcept
+        {
+            auto result = size_type(0u);
+            for (auto word : words_)
+                result += size_type(detail::popcount_impl(word));
+            return result;
+        }
+
+        /// \effects Calls `f` with the index of every row that is set,
+        /// in order of increasing index.
+        template <typename Func>
+        void for_each_row(Func&& f) const
+        {
+            for (size_type w = 0u; w != words_.size(); ++w)
+                for (auto word = words_[w]; word != 0u; word &= word - 1u)
+                    f(w * bits_per_word + size_type(detail::countr_zero_impl(word)));
+        }
+
+    private:
+        explicit row_mask(std::vector<std::uint64_t> words) : words_(std::move(words)) {}
+
+        std::vector<std::uint64_t> words_;
+
+        friend flag_set_column;
+    };
+
+    /// \group mask_op Bitwise operations for row_mask
+    friend row_mask operator&(const row_mask& a, const row_mask& b)
+    {
+        return a.bitwise_and(b);
+    }
+
+    /// \group mask_op
+    friend row_mask operator|(const row_mask& a, const row_mask& b)
+    {
+        return a.bitwise_or(b);
+    }
+
+    //=== modifiers ===//
+    /// \effects Conservatively allocates memory for at least `n` rows in every column.
+    void reserve(size_type n)
+    {
+        for (auto& column : columns_)
+            column.reserve(n / bits_per_word + 1u);
+    }
+
+    /// \effects Removes all rows.
+    void clear() noexcept
+    {
+        for (auto& column : columns_)
+            column.clear();
+        rows_ = 0u;
+    }
+
+    /// \effects Appends a row with the flags of the given set (1)/no flags set (2).
+    /// \group push_back
+    void push_back(const flag_set<Enum>& set)
+    {
+        grow_columns();
+        for (size_type c = 0u; c != no_columns; ++c)
+            if (set.is_set(static_cast<Enum>(c)))
+                columns_[c][word_index(rows_)] |= word_mask(rows_);
+        ++rows_;
+    }
+
+    /// \group push_back
+    void push_back(noflag_t)
+    {
+        grow_columns();
+        ++rows_;
+    }
+
+    /// \effects Removes the last row.
+    /// \requires `empty() == false`.
+    void pop_back() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!empty(), detail::precondition_error_handler{});
+        --rows_;
+        for (auto& column : columns_)
+        {
+            column[word_index(rows_)] &= ~word_mask(rows_);
+            if (column.size() * bits_per_word >= rows_ + bits_per_word)
+                column.pop_back();
+        }
+    }
+
+    //=== flag operation ===//
+    /// \effects Sets the specified flag of the given row to `1` (1)/`value` (2).
+    /// \requires `row < size()`.
+    /// \group set
+    void set(size_type row, const Enum& flag) noexcept
+    {
+        check_row(row);
+        columns_[column_index(flag)][word_index(row)] |= word_mask(row);
+    }
+
+    /// \group set
+    /// \param 2
+    /// \exclude
+    template <typename T, typename = detail::enable_boolean<T>>
+    void set(size_type row, const Enum& flag, T value) noexcept
+    {
+        if (value)
+            set(row, flag);
+        else
+            reset(row, flag);
+    }
+
+    /// \effects Sets the specified flag of the given row to `0`.
+    /// \requires `row < size()`.
+    void reset(size_type row, const Enum& flag) noexcept
+    {
+        check_row(row);
+        columns_[column_index(flag)][word_index(row)] &= ~word_mask(row);
+    }
+
+    /// \effects Toggles the specified flag of the given row.
+    /// \requires `row < size()`.
+    void toggle(size_type row, const Enum& flag) noexcept
+    {
+        check_row(row);
+        columns_[column_index(flag)][word_index(row)] ^= word_mask(row);
+    }
+
+    /// \returns Whether or not the specified flag of the given row is set.
+    /// \requires `row < size()`.
+    bool is_set(size_type row, const Enum& flag) const noexcept
+    {
+        check_row(row);
+        return (columns_[column_index(flag)][word_index(row)] & word_mask(row)) != 0u;
+    }
+
+    //=== observers ===//
+    /// \returns The number of rows.
+    size_type size() const noexcept
+    {
+        return rows_;
+    }
+
+    /// \returns Whether there are no rows.
+    bool empty() const noexcept
+    {
+        return rows_ == 0u;
+    }
+
+    /// \returns The flags of the given row gathered into a [ts::flag_set]().
+    /// \requires `row < size()`.
+    flag_set<Enum> operator[](size_type row) const noexcept
+    {
+        check_row(row);
+        flag_set<Enum> result;
+        for (size_type c = 0u; c != no_columns; ++c)
+            if ((columns_[c][word_index(row)] & word_mask(row)) != 0u)
+                result.set(static_cast<Enum>(c));
+        return result;
+    }
+
+    //=== column queries ===//
+    /// \returns The number of rows where the specified flag is set,
+    /// computed as a popcount over the column bitmap.
+    size_type count(const Enum& flag) const noexcept
+    {
+        auto result = size_type(0u);
+        for (auto word : columns_[column_index(flag)])
+            result += size_type(detail::popcount_impl(word));
+        return result;
+    }
+
+    /// \returns A [*row_mask]() of the rows where the specified flag is set.
+    row_mask column(const Enum& flag) const
+    {
+        return row_mask(columns_[column_index(flag)]);
+    }
+
+    /// \effects Calls `f` with the index of every row where the specified flag is set,
+    /// in order of increasing index.
+    template <typename Func>
+    void for_each_row(const Enum& flag, Func&& f) const
+    {
+        column(flag).for_each_row(std::forward<Func>(f));
+    }
+
+private:
+    static constexpr size_type no_columns    = flag_set_traits<Enum>::size();
+    static constexpr size_type bits_per_word = 64u;
+
+    static size_type column_index(const Enum& flag) noexcept
+    {
+        return static_cast<size_type>(flag);
+    }
+
+    static size_type word_index(size_type row) noexcept
+    {
+        return row / bits_per_word;
+    }
+
+    static std::uint64_t word_mask(size_type row) noexcept
+    {
+        return std::uint64_t(1) << (row % bits_per_word);
+    }
+
+    void check_row(size_type row) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(row < rows_, detail::precondition_error_handler{});
+    }
+
+    void grow_columns()
+    {
+        if (columns_[0u].size() * bits_per_word <= rows_)
+            for (auto& column : columns_)
+                column.push_back(0u);
+    }
+
+    std::vector<std::uint64_t> columns_[no_columns];
+    size_type                  rows_ = 0u;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_FLAG_SET_COLUMN_HPP_INCLUDED
@@ -9,6 +9,8 @@
 import std;
 #else
 #include <cstddef>
+#include <iterator>
+#include <utility>
 #endif
 
 #include <type_safe/config.hpp>
@@ -141,6 +143,27 @@ constexpr difference_t operator-(const index_t& lhs, const index_t& rhs) noexcep
     return difference_t(make_signed(get(lhs)) - make_signed(get(rhs)));
 }
 
+inline namespace literals
+{
+    /// Creates an [ts::index_t]() from a literal,
+    /// the value is parsed and range checked at compile-time.
+    /// \module types
+    template <char... Digits>
+    constexpr index_t operator"" _idx()
+    {
+        return index_t(detail::parse_unsigned<std::size_t, Digits...>());
+    }
+
+    /// Creates a [ts::difference_t]() from a literal,
+    /// the value is parsed and range checked at compile-time.
+    /// \module types
+    template <char... Digits>
+    constexpr difference_t operator"" _dist()
+    {
+        return difference_t(detail::parse_signed<std::ptrdiff_t, Digits...>());
+    }
+} // namespace literals
+
 /// \exclude
 namespace detail
 {
@@ -187,9 +210,9 @@ template <typename Indexable>
 auto at(Indexable&& obj, const index_t& index)
     -> decltype(std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index))])
 {
-    DEBUG_ASSERT(detail::index_valid(detail::member_size{}, obj,
-                                     static_cast<std::size_t>(get(index))),
-                 detail::precondition_error_handler{});
+    TYPE_SAFE_DETAIL_ASSERT(detail::index_valid(detail::member_size{}, obj,
+                            static_cast<std::size_t>(get(index))),
+                            detail::precondition_error_handler{});
     return std::forward<Indexable>(obj)[static_cast<std::size_t>(get(index))];
 }
 
@@ -226,6 +249,257 @@ constexpr index_t prev(const index_t& index, const difference_t& dist = differen
 {
     return index - dist;
 }
+
+/// A view to a `[begin, end)` window of an indexable object
+/// whose bounds are validated once at construction.
+///
+/// Unlike [ts::at](), which bounds-checks every access,
+/// the accessors and the iterator of the view are unchecked,
+/// so an inner loop over the window carries no per-element compare and branch
+/// and the compiler can vectorize it.
+/// The indices stay [ts::index_t]() typed, there is no raw `std::size_t` in the API.
+/// \requires The object must outlive the view and must not shrink below `end`.
+/// \module types
+template <typename Indexable>
+class checked_view
+{
+public:
+    /// \effects Creates a view to the window `[begin, end)` of `obj`,
+    /// validating it against the size of `obj` once.
+    /// \requires `begin <= end` and `end` must be at most the size of `obj`.
+    checked_view(Indexable& obj, const index_t& begin_index, const index_t& end_index)
+    : obj_(&obj), begin_(begin_index), end_(end_index)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(begin_index <= end_index, detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(begin_index == end_index
+                                || detail::index_valid(detail::member_size{}, obj,
+                                static_cast<std::size_t>(get(prev(end_index)))),
+                                detail::precondition_error_handler{});
+    }
+
+    /// \effects Creates a view to all elements of `obj`.
+    explicit checked_view(Indexable& obj) : checked_view(obj, index_t(), index_t(obj.size())) {}
+
+    /// A `RandomAccessIterator` over the window.
+    ///
+    /// It keeps the [ts::index_t]() typing:
+    /// advancing takes a [ts::difference_t]() and the distance between two iterators is one,
+    /// dereferencing is unchecked like the accessors of the view.
+    class iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type =
+            typename std::remove_cv<typename std::remove_reference<decltype(std::declval<
+                Indexable&>()[std::size_t()])>::type>::type;
+        using reference       = decltype(std::declval<Indexable&>()[std::size_t()]);
+        using pointer         = value_type*;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() noexcept : obj_(nullptr), cur_() {}
+
+        /// \returns The element at the current index, without a bounds check.
+        /// \requires The iterator must not be the past-the-end iterator.
+        reference operator*() const
+        {
+            return (*obj_)[static_cast<std::size_t>(get(cur_))];
+        }
+
+        /// \returns The element `dist` away from the current index, without a bounds check.
+        reference operator[](const difference_t& dist) const
+        {
+            return (*obj_)[static_cast<std::size_t>(get(cur_ + dist))];
+        }
+
+        /// \returns The [ts::index_t]() the iterator currently refers to.
+        index_t index() const noexcept
+        {
+            return cur_;
+        }
+
+        /// \group increment_decrement
+        iterator& operator++() noexcept
+        {
+            ++cur_;
+            return *this;
+        }
+
+        /// \group increment_decrement
+        iterator operator++(int) noexcept
+        {
+            auto save = *this;
+            ++cur_;
+            return save;
+        }
+
+        /// \group increment_decrement
+        iterator& operator--() noexcept
+        {
+            --cur_;
+            return *this;
+        }
+
+        /// \group increment_decrement
+        iterator operator--(int) noexcept
+        {
+            auto save = *this;
+            --cur_;
+            return save;
+        }
+
+        /// \group advance Advances the iterator by the given distance.
+        iterator& operator+=(const difference_t& dist) noexcept
+        {
+            cur_ += dist;
+            return *this;
+        }
+
+        /// \group advance
+        iterator& operator-=(const difference_t& dist) noexcept
+        {
+            cur_ -= dist;
+            return *this;
+        }
+
+        /// \group advance
+        friend iterator operator+(iterator iter, const difference_t& dist) noexcept
+        {
+            return iter += dist;
+        }
+
+        /// \group advance
+        friend iterator operator+(const difference_t& dist, iterator iter) noexcept
+        {
+            return iter += dist;
+        }
+
+        /// \group advance
+        friend iterator operator-(iterator iter, const difference_t& dist) noexcept
+        {
+            return iter -= dist;
+        }
+
+        /// \returns The [ts::difference_t]() between the two iterators.
+        friend difference_t operator-(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ - rhs.cur_;
+        }
+
+        /// \group comparison
+        friend bool operator==(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ == rhs.cur_;
+        }
+
+        /// \group comparison
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        /// \group comparison
+        friend bool operator<(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ < rhs.cur_;
+        }
+
+        /// \group comparison
+        friend bool operator<=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ <= rhs.cur_;
+        }
+
+        /// \group comparison
+        friend bool operator>(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ > rhs.cur_;
+        }
+
+        /// \group comparison
+        friend bool operator>=(const iterator& lhs, const iterator& rhs) noexcept
+        {
+            return lhs.cur_ >= rhs.cur_;
+        }
+
+    private:
+        iterator(Indexable* obj, const index_t& cur) noexcept : obj_(obj), cur_(cur) {}
+
+        Indexable* obj_;
+        index_t    cur_;
+
+        friend checked_view;
+    };
+
+    //=== accessors ===//
+    /// \returns The element at the given index, without a bounds check.
+    /// \requires `index` must be in the window validated at construction,
+    /// i.e. `begin_index() <= index && index < end_index()`.
+    /// \exclude return
+    auto operator[](const index_t& index) const
+        -> decltype(std::declval<Indexable&>()[std::size_t()])
+    {
+        return (*obj_)[static_cast<std::size_t>(get(index))];
+    }
+
+    /// \returns An iterator to the first index of the window (1)/past the window (2).
+    /// \group iteration
+    iterator begin() const noexcept
+    {
+        return iterator(obj_, begin_);
+    }
+
+    /// \group iteration
+    iterator end() const noexcept
+    {
+        return iterator(obj_, end_);
+    }
+
+    /// \returns The first index of the window (1)/the index past the window (2).
+    /// \group window
+    index_t begin_index() const noexcept
+    {
+        return begin_;
+    }
+
+    /// \group window
+    index_t end_index() const noexcept
+    {
+        return end_;
+    }
+
+    /// \returns The number of indices in the window.
+    difference_t size() const noexcept
+    {
+        return end_ - begin_;
+    }
+
+    /// \returns Whether the window is empty.
+    bool empty() const noexcept
+    {
+        return begin_ == end_;
+    }
+
+private:
+    Indexable* obj_;
+    index_t    begin_, end_;
+};
+
+/// \returns A [ts::checked_view]() to the given window (1)/all elements (2) of `obj`.
+/// \group make_checked_view
+/// \module types
+template <typename Indexable>
+checked_view<Indexable> make_checked_view(Indexable& obj, const index_t& begin_index,
+                                          const index_t& end_index)
+{
+    return checked_view<Indexable>(obj, begin_index, end_index);
+}
+
+/// \group make_checked_view
+template <typename Indexable>
+checked_view<Indexable> make_checked_view(Indexable& obj)
+{
+    return checked_view<Indexable>(obj);
+}
 } // namespace type_safe
 
 #endif // TYPE_SAFE_INDEX_HPP_INCLUDED
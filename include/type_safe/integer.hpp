@@ -8,6 +8,7 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#    include <cstdint>
 #    include <functional>
 #    include <iosfwd>
 #    include <limits>
@@ -449,6 +450,183 @@ TYPE_SAFE_FORCE_INLINE constexpr integer<UnsignedInteger, Policy> abs(
     return i;
 }
 
+//=== bit operations ===//
+/// \exclude
+namespace detail
+{
+#if defined(__GNUC__)
+    template <typename T>
+    constexpr int popcount_impl(T x) noexcept
+    {
+        return __builtin_popcountll(x);
+    }
+
+    // \requires x != 0
+    template <typename T>
+    constexpr int countl_zero_impl(T x) noexcept
+    {
+        return __builtin_clzll(x) - int(64u - sizeof(T) * 8u);
+    }
+
+    // \requires x != 0
+    template <typename T>
+    constexpr int countr_zero_impl(T x) noexcept
+    {
+        return __builtin_ctzll(x);
+    }
+#else
+    template <typename T>
+    TYPE_SAFE_CONSTEXPR14 int popcount_impl(T x) noexcept
+    {
+        auto result = 0;
+        for (; x != T(0); x = T(x >> 1))
+            result += int(x & T(1));
+        return result;
+    }
+
+    // \requires x != 0
+    template <typename T>
+    TYPE_SAFE_CONSTEXPR14 int countl_zero_impl(T x) noexcept
+    {
+        auto result = int(sizeof(T) * 8) - 1;
+        for (; x != T(1); x = T(x >> 1))
+            --result;
+        return result;
+    }
+
+    // \requires x != 0
+    template <typename T>
+    TYPE_SAFE_CONSTEXPR14 int countr_zero_impl(T x) noexcept
+    {
+        auto result = 0;
+        for (; (x & T(1)) == T(0); x = T(x >> 1))
+            ++result;
+        return result;
+    }
+#endif
+
+    template <typename T>
+    constexpr T byteswap_impl(T x, std::integral_constant<std::size_t, 1>) noexcept
+    {
+        return x;
+    }
+    template <typename T>
+    constexpr T byteswap_impl(T x, std::integral_constant<std::size_t, 2>) noexcept
+    {
+        return T(T(x >> 8) | T(x << 8));
+    }
+    template <typename T>
+    constexpr T byteswap_impl(T x, std::integral_constant<std::size_t, 4>) noexcept
+    {
+        return T(T(T(x >> 24) & T(0xFF)) | T(T(x >> 8) & T(0xFF00)) | T(T(x << 8) & T(0xFF0000))
+                 | T(x << 24));
+    }
+    template <typename T>
+    constexpr T byteswap_impl(T x, std::integral_constant<std::size_t, 8>) noexcept
+    {
+        return T(T(byteswap_impl(std::uint32_t(x >> 32), std::integral_constant<std::size_t, 4>{}))
+                 | T(T(byteswap_impl(std::uint32_t(x), std::integral_constant<std::size_t, 4>{}))
+                     << 32));
+    }
+
+    template <typename T>
+    using enable_unsigned_integer =
+        typename std::enable_if<is_integer<T>::value && std::is_unsigned<T>::value>::type;
+} // namespace detail
+
+/// \returns The number of set bits in the value of `i` as a [ts::integer]().
+/// \notes As for the C++20 bit functions in the `<bit>` header,
+/// the integer type must be unsigned.
+/// These functions lower to the corresponding hardware instructions where available.
+/// \module types
+/// \group int_bit_op Bit operations
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<unsigned, Policy> popcount(
+    const integer<UnsignedInteger, Policy>& i) noexcept
+{
+    return integer<unsigned, Policy>(
+        static_cast<unsigned>(detail::popcount_impl(static_cast<UnsignedInteger>(i))));
+}
+
+/// \returns The number of consecutive zero bits, starting from the most significant bit.
+/// \group int_bit_op
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<unsigned, Policy> countl_zero(
+    const integer<UnsignedInteger, Policy>& i) noexcept
+{
+    return integer<unsigned, Policy>(
+        static_cast<UnsignedInteger>(i) == UnsignedInteger(0)
+            ? unsigned(sizeof(UnsignedInteger) * 8)
+            : static_cast<unsigned>(detail::countl_zero_impl(static_cast<UnsignedInteger>(i))));
+}
+
+/// \returns The number of consecutive zero bits, starting from the least significant bit.
+/// \group int_bit_op
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<unsigned, Policy> countr_zero(
+    const integer<UnsignedInteger, Policy>& i) noexcept
+{
+    return integer<unsigned, Policy>(
+        static_cast<UnsignedInteger>(i) == UnsignedInteger(0)
+            ? unsigned(sizeof(UnsignedInteger) * 8)
+            : static_cast<unsigned>(detail::countr_zero_impl(static_cast<UnsignedInteger>(i))));
+}
+
+/// \returns The value of `i` rotated left (`rotl`) or right (`rotr`) by `shift` bits.
+/// A negative or too large shift is taken modulo the number of bits.
+/// \group int_bit_op
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<UnsignedInteger, Policy> rotl(
+    const integer<UnsignedInteger, Policy>& i, int shift) noexcept
+{
+    return (unsigned(shift) & (sizeof(UnsignedInteger) * 8u - 1u)) == 0u
+               ? i
+               : integer<UnsignedInteger, Policy>(UnsignedInteger(
+                     UnsignedInteger(static_cast<UnsignedInteger>(i)
+                                     << (unsigned(shift) & (sizeof(UnsignedInteger) * 8u - 1u)))
+                     | UnsignedInteger(
+                         static_cast<UnsignedInteger>(i)
+                         >> (sizeof(UnsignedInteger) * 8u
+                             - (unsigned(shift) & (sizeof(UnsignedInteger) * 8u - 1u))))));
+}
+
+/// \group int_bit_op
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<UnsignedInteger, Policy> rotr(
+    const integer<UnsignedInteger, Policy>& i, int shift) noexcept
+{
+    return rotl(i, -shift);
+}
+
+/// \returns The value of `i` with the order of its bytes reversed.
+/// \group int_bit_op
+/// \param 2
+/// \exclude
+template <typename UnsignedInteger, class Policy,
+          typename = detail::enable_unsigned_integer<UnsignedInteger>>
+TYPE_SAFE_FORCE_INLINE constexpr integer<UnsignedInteger, Policy> byteswap(
+    const integer<UnsignedInteger, Policy>& i) noexcept
+{
+    return integer<UnsignedInteger, Policy>(
+        detail::byteswap_impl(static_cast<UnsignedInteger>(i),
+                              std::integral_constant<std::size_t, sizeof(UnsignedInteger)>{}));
+}
+
 //=== comparison ===//
 /// \exclude
 namespace detail
@@ -728,6 +906,53 @@ TYPE_SAFE_DETAIL_MAKE_OP(%)
 
 #undef TYPE_SAFE_DETAIL_MAKE_OP
 
+//=== non-throwing checked operations ===//
+/// \exclude
+#define TYPE_SAFE_DETAIL_MAKE_TRY_OP(Name, Check, Op)                                              \
+    /** \group int_try_op                                                                          \
+     * \exclude return */                                                                          \
+    template <typename A, typename B, class Policy>                                                \
+    TYPE_SAFE_FORCE_INLINE constexpr auto Name(const integer<A, Policy>& a,                        \
+                                               const integer<B, Policy>& b) noexcept               \
+        ->arith_result<integer<detail::integer_result_t<A, B>, Policy>>                            \
+    {                                                                                              \
+        using type = detail::integer_result_t<A, B>;                                               \
+        return detail::Check(detail::arithmetic_tag_for<type>{}, type(static_cast<A>(a)),          \
+                             type(static_cast<B>(b)))                                              \
+                   ? arith_result<integer<type, Policy>>(arith_error{})                            \
+                   : arith_result<integer<type, Policy>>(                                          \
+                       integer<type, Policy>(type(type(static_cast<A>(a))                          \
+                                                      Op type(static_cast<B>(b)))));               \
+    }
+
+/// \returns An [ts::arith_result]() containing the result of the binary operation
+/// on the stored integer values, or one in the error state if it would under/overflow.
+/// \notes Unlike [ts::checked_arithmetic]() these functions never throw,
+/// regardless of the `Policy` of the operands,
+/// so they can be used in `-fno-exceptions` builds.
+/// \group int_try_op Non-throwing checked operations
+/// \module types
+/// \exclude return
+TYPE_SAFE_DETAIL_MAKE_TRY_OP(try_add, will_addition_error, +)
+
+/// \group int_try_op
+/// \exclude return
+TYPE_SAFE_DETAIL_MAKE_TRY_OP(try_sub, will_subtraction_error, -)
+
+/// \group int_try_op
+/// \exclude return
+TYPE_SAFE_DETAIL_MAKE_TRY_OP(try_mul, will_multiplication_error, *)
+
+/// \group int_try_op
+/// \exclude return
+TYPE_SAFE_DETAIL_MAKE_TRY_OP(try_div, will_division_error, /)
+
+/// \group int_try_op
+/// \exclude return
+TYPE_SAFE_DETAIL_MAKE_TRY_OP(try_mod, will_modulo_error, %)
+
+#undef TYPE_SAFE_DETAIL_MAKE_TRY_OP
+
 //=== input/output ===/
 /// \effects Reads an integer from the [std::istream]() and assigns it to the given [ts::integer]().
 /// \module types
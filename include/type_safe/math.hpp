@@ -0,0 +1,87 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_MATH_HPP_INCLUDED
+#define TYPE_SAFE_MATH_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cmath>
+#endif
+
+#include <type_safe/detail/force_inline.hpp>
+#include <type_safe/floating_point.hpp>
+
+namespace type_safe
+{
+/// \exclude
+#define TYPE_SAFE_DETAIL_MAKE_UNARY(Name, Func)                                                    \
+    /** [std::Func]() for [ts::floating_point]().                                                  \
+     * \module types                                                                               \
+     * \group float_math Math functions */                                                         \
+    template <typename FloatT>                                                                     \
+    TYPE_SAFE_FORCE_INLINE floating_point<FloatT> Name(const floating_point<FloatT>& x) noexcept   \
+    {                                                                                              \
+        return floating_point<FloatT>(std::Func(static_cast<FloatT>(x)));                          \
+    }
+
+/// \exclude
+#define TYPE_SAFE_DETAIL_MAKE_BINARY(Name, Func)                                                   \
+    /** [std::Func]() for [ts::floating_point]().                                                  \
+     * \module types                                                                               \
+     * \group float_math */                                                                        \
+    template <typename FloatT>                                                                     \
+    TYPE_SAFE_FORCE_INLINE floating_point<FloatT> Name(const floating_point<FloatT>& x,            \
+                                                       const floating_point<FloatT>& y) noexcept   \
+    {                                                                                              \
+        return floating_point<FloatT>(std::Func(static_cast<FloatT>(x), static_cast<FloatT>(y)));  \
+    }
+
+TYPE_SAFE_DETAIL_MAKE_UNARY(abs, fabs)
+TYPE_SAFE_DETAIL_MAKE_UNARY(sqrt, sqrt)
+TYPE_SAFE_DETAIL_MAKE_UNARY(cbrt, cbrt)
+TYPE_SAFE_DETAIL_MAKE_UNARY(exp, exp)
+TYPE_SAFE_DETAIL_MAKE_UNARY(exp2, exp2)
+TYPE_SAFE_DETAIL_MAKE_UNARY(log, log)
+TYPE_SAFE_DETAIL_MAKE_UNARY(log2, log2)
+TYPE_SAFE_DETAIL_MAKE_UNARY(log10, log10)
+TYPE_SAFE_DETAIL_MAKE_UNARY(sin, sin)
+TYPE_SAFE_DETAIL_MAKE_UNARY(cos, cos)
+TYPE_SAFE_DETAIL_MAKE_UNARY(tan, tan)
+TYPE_SAFE_DETAIL_MAKE_UNARY(asin, asin)
+TYPE_SAFE_DETAIL_MAKE_UNARY(acos, acos)
+TYPE_SAFE_DETAIL_MAKE_UNARY(atan, atan)
+TYPE_SAFE_DETAIL_MAKE_UNARY(floor, floor)
+TYPE_SAFE_DETAIL_MAKE_UNARY(ceil, ceil)
+TYPE_SAFE_DETAIL_MAKE_UNARY(trunc, trunc)
+TYPE_SAFE_DETAIL_MAKE_UNARY(round, round)
+
+TYPE_SAFE_DETAIL_MAKE_BINARY(pow, pow)
+TYPE_SAFE_DETAIL_MAKE_BINARY(atan2, atan2)
+TYPE_SAFE_DETAIL_MAKE_BINARY(fmod, fmod)
+TYPE_SAFE_DETAIL_MAKE_BINARY(hypot, hypot)
+TYPE_SAFE_DETAIL_MAKE_BINARY(min, fmin)
+TYPE_SAFE_DETAIL_MAKE_BINARY(max, fmax)
+TYPE_SAFE_DETAIL_MAKE_BINARY(copysign, copysign)
+
+#undef TYPE_SAFE_DETAIL_MAKE_UNARY
+#undef TYPE_SAFE_DETAIL_MAKE_BINARY
+
+/// [std::fma]() for [ts::floating_point]().
+/// \notes Forwarding to the library function keeps the fused multiply-add
+/// contraction the compiler would do on the raw type.
+/// \module types
+/// \group float_math
+template <typename FloatT>
+TYPE_SAFE_FORCE_INLINE floating_point<FloatT> fma(const floating_point<FloatT>& x,
+                                                  const floating_point<FloatT>& y,
+                                                  const floating_point<FloatT>& z) noexcept
+{
+    return floating_point<FloatT>(
+        std::fma(static_cast<FloatT>(x), static_cast<FloatT>(y), static_cast<FloatT>(z)));
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_MATH_HPP_INCLUDED
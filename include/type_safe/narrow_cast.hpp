@@ -5,6 +5,12 @@
 #ifndef TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
 #define TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
 
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cmath>
+#endif
+
 #include <type_safe/floating_point.hpp>
 #include <type_safe/integer.hpp>
 
@@ -116,6 +122,133 @@ TYPE_SAFE_FORCE_INLINE constexpr auto narrow_cast(const floating_point<Source>&
     using target_t     = typename target_float::floating_point_type;
     return narrow_cast<target_t>(static_cast<Source>(source));
 }
+
+/// Tag types to select the rounding mode of [ts::round_cast]().
+/// \group rounding_mode Rounding mode tags
+struct round_nearest_t
+{
+    constexpr round_nearest_t() {}
+};
+/// \group rounding_mode
+struct round_floor_t
+{
+    constexpr round_floor_t() {}
+};
+/// \group rounding_mode
+struct round_ceil_t
+{
+    constexpr round_ceil_t() {}
+};
+/// \group rounding_mode
+struct round_truncate_t
+{
+    constexpr round_truncate_t() {}
+};
+
+/// Tag objects of the [ts::round_nearest_t]() etc. rounding mode tags.
+/// \group rounding_mode_obj Rounding mode tag objects
+constexpr round_nearest_t round_nearest;
+/// \group rounding_mode_obj
+constexpr round_floor_t round_floor;
+/// \group rounding_mode_obj
+constexpr round_ceil_t round_ceil;
+/// \group rounding_mode_obj
+constexpr round_truncate_t round_truncate;
+
+/// \exclude
+namespace detail
+{
+    // Rounding happens in the floating point domain,
+    // so the range check below is a plain comparison
+    // and the whole cast vectorizes (round + convert),
+    // unlike a convert-back-and-compare per element.
+    template <typename Source>
+    TYPE_SAFE_FORCE_INLINE Source round_in_float(const Source& source, round_nearest_t) noexcept
+    {
+        return std::nearbyint(source);
+    }
+    template <typename Source>
+    TYPE_SAFE_FORCE_INLINE Source round_in_float(const Source& source, round_floor_t) noexcept
+    {
+        return std::floor(source);
+    }
+    template <typename Source>
+    TYPE_SAFE_FORCE_INLINE Source round_in_float(const Source& source, round_ceil_t) noexcept
+    {
+        return std::ceil(source);
+    }
+    template <typename Source>
+    TYPE_SAFE_FORCE_INLINE Source round_in_float(const Source& source, round_truncate_t) noexcept
+    {
+        return std::trunc(source);
+    }
+
+    // `2^(n-1)`/`2^n` are exactly representable powers of two,
+    // so the half-open range `[lower, upper)` is exact in the source type,
+    // where converting `max()` itself could round up and admit an overflowing value.
+    template <typename Target, typename Source>
+    TYPE_SAFE_FORCE_INLINE constexpr bool fits_in_integer(const Source& rounded) noexcept
+    {
+        return rounded < Source(std::numeric_limits<Target>::max() / 2 + 1) * Source(2)
+               && (std::is_signed<Target>::value
+                       ? rounded >= -(Source(std::numeric_limits<Target>::max() / 2 + 1)
+                                      * Source(2))
+                       : rounded >= Source(0));
+    }
+
+    template <typename T>
+    struct get_rounded_integer
+    {
+        using type = integer<T, arithmetic_policy_default>;
+    };
+    template <typename T, class Policy>
+    struct get_rounded_integer<integer<T, Policy>>
+    {
+        using type = integer<T, Policy>;
+    };
+} // namespace detail
+
+/// \returns `source` rounded with the requested mode and converted to the integer type `Target`.
+///
+/// Unlike [ts::narrow_cast]() fractional values are allowed,
+/// the mode decides where they go: [ts::round_nearest](), [ts::round_floor](),
+/// [ts::round_ceil]() or [ts::round_truncate]().
+/// Rounding and the range precondition both stay in the floating point domain,
+/// so with precondition checks disabled this lowers to the hardware round and convert
+/// instructions and vectorizes; truncation is the bare convert.
+/// \requires The rounded value must be representable by the target type.
+/// \module types
+/// \param 3
+/// \exclude
+template <typename Target, typename Source, class RoundingMode,
+          typename = typename std::enable_if<std::is_floating_point<Source>::value>::type>
+TYPE_SAFE_FORCE_INLINE Target round_cast(const Source& source, RoundingMode mode) noexcept
+{
+    using underlying = typename detail::get_target_underlying_integer<Target>::type;
+    static_assert(std::is_integral<underlying>::value, "round_cast target must be an integer");
+
+    auto rounded = detail::round_in_float(source, mode);
+    TYPE_SAFE_DETAIL_ASSERT(detail::fits_in_integer<underlying>(rounded),
+                            detail::precondition_error_handler{},
+                            "rounded value not representable in target type");
+    return static_cast<Target>(static_cast<underlying>(rounded));
+}
+
+/// \returns A [ts::integer]() with the value of `source` rounded with the requested mode.
+/// \requires The rounded value must be representable by the target type.
+/// \notes `Target` can either be a specialization of the `integer` template itself
+/// or a built-in integer type, the result will be wrapped if needed.
+/// \module types
+/// \exclude return
+template <typename Target, typename Source, class RoundingMode>
+TYPE_SAFE_FORCE_INLINE auto round_cast(const floating_point<Source>& source,
+                                       RoundingMode mode) noexcept ->
+    typename detail::get_rounded_integer<Target>::type
+{
+    using target_integer = typename detail::get_rounded_integer<Target>::type;
+    using target_t       = typename target_integer::integer_type;
+    return round_cast<target_t>(static_cast<Source>(source), mode);
+}
 } // namespace type_safe
 
 #endif // TYPE_SAFE_NARROW_CAST_HPP_INCLUDED
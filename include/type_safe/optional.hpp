@@ -9,6 +9,7 @@
 import std;
 #else
 #include <functional>
+#include <memory>
 #include <new>
 #include <type_traits>
 #endif
@@ -27,37 +28,67 @@ class basic_optional;
 /// \exclude
 namespace detail
 {
-    template <class StoragePolicy>
+#if defined(__GNUC__) && __GNUC__ < 5
+    // does not have is_trivially_copyable
+    template <typename T>
+    using is_trivial_optional_value = std::is_trivial<T>;
+#else
+    template <typename T>
+    using is_trivial_optional_value = std::is_trivially_copyable<T>;
+#endif
+
+    // Converts to the result of invoking the factory,
+    // so `create_value()` constructs that result directly into the storage:
+    // the conversion happens inside the placement new expression,
+    // where the return value is elided into the storage
+    // (guaranteed since C++17, done in practice by all supported compilers before).
+    template <typename Func>
+    struct factory_invoker
+    {
+        Func&& func;
+
+        using result_type = decltype(std::declval<Func&&>()());
+
+        operator result_type()
+        {
+            return std::forward<Func>(func)();
+        }
+    };
+
+    template <class StoragePolicy,
+              bool Trivial
+              = is_trivial_optional_value<StoragePolicy>::value&&
+                  is_trivial_optional_value<typename StoragePolicy::value_type>::value>
     struct optional_storage
     {
         StoragePolicy storage;
 
         optional_storage() noexcept = default;
 
-        optional_storage(const optional_storage& other)
+        TYPE_SAFE_CONSTEXPR20 optional_storage(const optional_storage& other)
         {
             storage.create_value(other.storage);
         }
 
-        optional_storage(optional_storage&& other) noexcept(
+        TYPE_SAFE_CONSTEXPR20 optional_storage(optional_storage&& other) noexcept(
             std::is_nothrow_move_constructible<typename StoragePolicy::value_type>::value)
         {
             storage.create_value(std::move(other.storage));
         }
 
-        ~optional_storage() noexcept
+        TYPE_SAFE_CONSTEXPR20 ~optional_storage() noexcept
         {
             if (storage.has_value())
                 storage.destroy_value();
         }
 
-        optional_storage& operator=(const optional_storage& other)
+        TYPE_SAFE_CONSTEXPR20 optional_storage& operator=(const optional_storage& other)
         {
             storage.copy_value(other.storage);
             return *this;
         }
 
-        optional_storage& operator=(optional_storage&& other) noexcept(
+        TYPE_SAFE_CONSTEXPR20 optional_storage& operator=(optional_storage&& other) noexcept(
             std::is_nothrow_move_constructible<typename StoragePolicy::value_type>::value
             && (!std::is_move_assignable<typename StoragePolicy::value_type>::value
                 || std::is_nothrow_move_assignable<typename StoragePolicy::value_type>::value))
@@ -67,6 +98,17 @@ namespace detail
         }
     };
 
+    // For a trivially copyable value type all special members can be defaulted,
+    // copying the policy byte-wise copies both the flag and the value (if any).
+    // The optional is then itself trivially copyable and trivially destructible.
+    template <class StoragePolicy>
+    struct optional_storage<StoragePolicy, true>
+    {
+        StoragePolicy storage;
+
+        optional_storage() noexcept = default;
+    };
+
     template <typename T>
     using optional_copy = copy_control<std::is_copy_constructible<T>::value>;
 
@@ -215,23 +257,23 @@ public:
     using rebind = detail::rebind_optional<U, typename StoragePolicy::template rebind<U>>;
 
 private:
-    storage& get_storage() TYPE_SAFE_LVALUE_REF noexcept
+    TYPE_SAFE_CONSTEXPR20 storage& get_storage() TYPE_SAFE_LVALUE_REF noexcept
     {
         return static_cast<detail::optional_storage<StoragePolicy>&>(*this).storage;
     }
 
-    const storage& get_storage() const TYPE_SAFE_LVALUE_REF noexcept
+    TYPE_SAFE_CONSTEXPR20 const storage& get_storage() const TYPE_SAFE_LVALUE_REF noexcept
     {
         return static_cast<const detail::optional_storage<StoragePolicy>&>(*this).storage;
     }
 
 #if TYPE_SAFE_USE_REF_QUALIFIERS
-    storage&& get_storage() && noexcept
+    TYPE_SAFE_CONSTEXPR20 storage&& get_storage() && noexcept
     {
         return std::move(static_cast<detail::optional_storage<StoragePolicy>&>(*this).storage);
     }
 
-    const storage&& get_storage() const&& noexcept
+    TYPE_SAFE_CONSTEXPR20 const storage&& get_storage() const&& noexcept
     {
         return std::move(
             static_cast<const detail::optional_storage<StoragePolicy>&>(*this).storage);
@@ -245,7 +287,7 @@ public:
     basic_optional() noexcept = default;
 
     /// \group empty
-    basic_optional(nullopt_t) noexcept {}
+    TYPE_SAFE_CONSTEXPR20 basic_optional(nullopt_t) noexcept {}
 
     /// \effects Creates it with a value by forwarding `value`.
     /// \throws Anything thrown by the constructor of `value_type`.
@@ -254,7 +296,7 @@ public:
     /// \exclude
     template <typename T, typename = typename std::enable_if<!std::is_same<
                               typename std::decay<T>::type, basic_optional<storage>>::value>::type>
-    basic_optional(T&& value,
+    TYPE_SAFE_CONSTEXPR20 basic_optional(T&& value,
                    decltype(std::declval<storage>().create_value(std::declval<T>()), 0) = 0)
     {
         get_storage().create_value(std::forward<T>(value));
@@ -270,7 +312,7 @@ public:
         typename std::enable_if<
             !std::is_same<typename std::decay<T>::type, basic_optional<storage>>::value, int>::type
         = 0>
-    explicit basic_optional(
+    TYPE_SAFE_CONSTEXPR20 explicit basic_optional(
         T&& value,
         decltype(std::declval<storage>().create_value_explicit(std::declval<T>()), 0) = 0)
     {
@@ -302,7 +344,7 @@ public:
     ~basic_optional() noexcept = default;
 
     /// \effects Same as `reset()`.
-    basic_optional& operator=(nullopt_t) noexcept
+    TYPE_SAFE_CONSTEXPR20 basic_optional& operator=(nullopt_t) noexcept
     {
         reset();
         return *this;
@@ -315,7 +357,7 @@ public:
     /// \synopsis_return basic_optional&
     template <typename T, typename = typename std::enable_if<!std::is_same<
                               typename std::decay<T>::type, basic_optional<storage>>::value>::type>
-    auto operator=(T&& value) -> decltype(
+    TYPE_SAFE_CONSTEXPR20 auto operator=(T&& value) -> decltype(
         std::declval<basic_optional<storage>>().get_storage().create_value(std::forward<T>(value)),
         *this)
     {
@@ -348,7 +390,7 @@ public:
     /// Otherwise, if only one of them have a value, moves that value to the other one and makes the
     /// moved-from empty. Otherwise, if both are empty, does nothing. \throws Anything thrown by the
     /// move construction or swap.
-    friend void swap(basic_optional& a, basic_optional& b) noexcept(
+    friend TYPE_SAFE_CONSTEXPR20 void swap(basic_optional& a, basic_optional& b) noexcept(
         std::is_nothrow_move_constructible<value_type>::value&&
             detail::is_nothrow_swappable<value_type>::value)
     {
@@ -359,7 +401,7 @@ public:
     /// \effects Destroys the value by calling its destructor, if there is any stored.
     /// Afterwards `has_value()` will return `false`.
     /// \output_section Modifiers
-    void reset() noexcept
+    TYPE_SAFE_CONSTEXPR20 void reset() noexcept
     {
         if (has_value())
             get_storage().destroy_value();
@@ -372,7 +414,7 @@ public:
     /// \notes If the `create_value()` function of the `StoragePolicy` does not accept the
     /// arguments, this function will not participate in overload resolution. \synopsis_return void
     template <typename... Args>
-    auto emplace(Args&&... args) noexcept(std::is_nothrow_constructible<value_type, Args...>::value)
+    TYPE_SAFE_CONSTEXPR20 auto emplace(Args&&... args) noexcept(std::is_nothrow_constructible<value_type, Args...>::value)
         -> decltype(std::declval<basic_optional<storage>>().get_storage().create_value(
             std::forward<Args>(args)...))
     {
@@ -389,7 +431,7 @@ public:
     template <typename Arg,
               typename = typename std::enable_if<detail::is_direct_assignable<
                   decltype(std::declval<storage&>().get_value()), Arg&&>::value>::type>
-    auto emplace(Arg&& arg) noexcept(std::is_nothrow_constructible<value_type, Arg>::value&&
+    TYPE_SAFE_CONSTEXPR20 auto emplace(Arg&& arg) noexcept(std::is_nothrow_constructible<value_type, Arg>::value&&
                                          std::is_nothrow_assignable<value_type, Arg>::value)
         -> decltype(std::declval<basic_optional<storage>>().get_storage().create_value(
             std::forward<Arg>(arg)))
@@ -400,16 +442,33 @@ public:
             value() = std::forward<Arg>(arg);
     }
 
+    /// \effects First destroys any old value like `reset()`.
+    /// Then invokes `f` and constructs its result directly into the storage,
+    /// without materializing it in a temporary first.
+    /// \throws Anything thrown by `f` or the constructor of `value_type`.
+    /// If this function is left by an exception, the optional will be empty.
+    /// \notes Unlike `emplace(f())` this never moves the result,
+    /// so it is the way to fill an optional with an expensive-to-copy value.
+    /// \synopsis_return void
+    template <typename Func>
+    TYPE_SAFE_CONSTEXPR20 auto emplace_result(Func&& f)
+        -> decltype(std::declval<basic_optional<storage>>().get_storage().create_value(
+            std::declval<detail::factory_invoker<Func>>()))
+    {
+        reset();
+        get_storage().create_value(detail::factory_invoker<Func>{std::forward<Func>(f)});
+    }
+
     //=== observers ===//
     /// \returns The same as `has_value()`.
     /// \output_section Observers
-    explicit operator bool() const noexcept
+    TYPE_SAFE_CONSTEXPR20 explicit operator bool() const noexcept
     {
         return has_value();
     }
 
     /// \returns Whether or not the optional has a value.
-    bool has_value() const noexcept
+    TYPE_SAFE_CONSTEXPR20 bool has_value() const noexcept
     {
         return get_storage().has_value();
     }
@@ -419,32 +478,34 @@ public:
     /// The exact type depends on the `StoragePolicy`.
     /// \requires `has_value() == true`.
     /// \group value
-    auto value() TYPE_SAFE_LVALUE_REF noexcept -> decltype(std::declval<storage&>().get_value())
+    TYPE_SAFE_CONSTEXPR20 auto value() TYPE_SAFE_LVALUE_REF noexcept
+        -> decltype(std::declval<storage&>().get_value())
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return get_storage().get_value();
     }
 
     /// \group value
-    auto value() const TYPE_SAFE_LVALUE_REF noexcept
+    TYPE_SAFE_CONSTEXPR20 auto value() const TYPE_SAFE_LVALUE_REF noexcept
         -> decltype(std::declval<const storage&>().get_value())
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return get_storage().get_value();
     }
 
 #if TYPE_SAFE_USE_REF_QUALIFIERS
     /// \group value
-    auto value() && noexcept -> decltype(std::declval<storage&&>().get_value())
+    TYPE_SAFE_CONSTEXPR20 auto value() && noexcept -> decltype(std::declval<storage&&>().get_value())
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return std::move(get_storage()).get_value();
     }
 
     /// \group value
-    auto value() const && noexcept -> decltype(std::declval<const storage&&>().get_value())
+    TYPE_SAFE_CONSTEXPR20 auto value() const&& noexcept
+        -> decltype(std::declval<const storage&&>().get_value())
     {
-        DEBUG_ASSERT(has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(has_value(), detail::precondition_error_handler{});
         return std::move(get_storage()).get_value();
     }
 #endif
@@ -454,7 +515,7 @@ public:
     /// `StoragePolicy`. \notes Depending on the `StoragePolicy`, this either returns a decayed type
     /// or a reference. \group value_or
     template <typename U>
-    auto value_or(U&& u) const TYPE_SAFE_LVALUE_REF
+    TYPE_SAFE_CONSTEXPR20 auto value_or(U&& u) const TYPE_SAFE_LVALUE_REF
         -> decltype(std::declval<const storage&>().get_value_or(std::forward<U>(u)))
     {
         return get_storage().get_value_or(std::forward<U>(u));
@@ -463,12 +524,39 @@ public:
 #if TYPE_SAFE_USE_REF_QUALIFIERS
     /// \group value_or
     template <typename U>
-    auto value_or(U&& u) && -> decltype(std::declval<storage&&>().get_value_or(std::forward<U>(u)))
+    TYPE_SAFE_CONSTEXPR20 auto value_or(U&& u) &&
+        -> decltype(std::declval<storage&&>().get_value_or(std::forward<U>(u)))
     {
         return std::move(get_storage()).get_value_or(std::forward<U>(u));
     }
 #endif
 
+    /// \returns If it has a value, `value()`, otherwise the result of invoking `f`.
+    /// \requires The result of `f` must be a valid argument to the `value_or()` function of the
+    /// `StoragePolicy`. \notes Unlike `value_or()` the fallback is computed lazily,
+    /// so `f` is only invoked — and the fallback only constructed — on the empty path.
+    /// \group value_or_eval
+    template <typename Func>
+    TYPE_SAFE_CONSTEXPR20 auto value_or_eval(Func&& f) const TYPE_SAFE_LVALUE_REF
+        -> decltype(std::declval<const storage&>().get_value_or(std::declval<Func&&>()()))
+    {
+        if (has_value())
+            return get_storage().get_value();
+        return std::forward<Func>(f)();
+    }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+    /// \group value_or_eval
+    template <typename Func>
+    TYPE_SAFE_CONSTEXPR20 auto value_or_eval(Func&& f) &&
+        -> decltype(std::declval<storage&&>().get_value_or(std::declval<Func&&>()()))
+    {
+        if (has_value())
+            return std::move(get_storage()).get_value();
+        return std::forward<Func>(f)();
+    }
+#endif
+
     //=== factories ===//
     /// Maps an optional.
     /// \effects If the optional contains a value,
@@ -558,18 +646,136 @@ public:
             return static_cast<rebind<return_type>>(nullopt);
     }
 #endif
+
+    /// Fused map chain.
+    /// \effects If the optional contains a value,
+    /// calls the first function with the value
+    /// and every following function with the result of the previous one.
+    /// \returns A `basic_optional` rebound to the result type of the last function,
+    /// that is empty if `*this` is empty and contains the final result otherwise.
+    /// \notes This behaves like the equivalent chain of [ts::basic_optional::map]() calls,
+    /// except that `has_value()` is only checked once
+    /// and no intermediate optionals are created.
+    /// \unique_name *pipe
+    /// \group pipe
+    /// \exclude return
+    template <typename Func, typename... Rest>
+    auto pipe(Func&& f, Rest&&... rest) TYPE_SAFE_LVALUE_REF
+#if !TYPE_SAFE_USE_RETURN_TYPE_DEDUCTION
+        -> rebind<decltype(detail::pipe_invoke(this->value(), std::forward<Func>(f),
+                                               std::forward<Rest>(rest)...))>
+#endif
+    {
+        using return_type = decltype(
+            detail::pipe_invoke(value(), std::forward<Func>(f), std::forward<Rest>(rest)...));
+        if (has_value())
+            return rebind<return_type>(
+                detail::pipe_invoke(value(), std::forward<Func>(f), std::forward<Rest>(rest)...));
+        else
+            return static_cast<rebind<return_type>>(nullopt);
+    }
+
+    /// \unique_name *pipe_const
+    /// \group pipe
+    /// \exclude return
+    template <typename Func, typename... Rest>
+    auto pipe(Func&& f, Rest&&... rest) const TYPE_SAFE_LVALUE_REF
+#if !TYPE_SAFE_USE_RETURN_TYPE_DEDUCTION
+        -> rebind<decltype(detail::pipe_invoke(this->value(), std::forward<Func>(f),
+                                               std::forward<Rest>(rest)...))>
+#endif
+    {
+        using return_type = decltype(
+            detail::pipe_invoke(value(), std::forward<Func>(f), std::forward<Rest>(rest)...));
+        if (has_value())
+            return rebind<return_type>(
+                detail::pipe_invoke(value(), std::forward<Func>(f), std::forward<Rest>(rest)...));
+        else
+            return static_cast<rebind<return_type>>(nullopt);
+    }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+    /// \unique_name *pipe_rvalue
+    /// \group pipe
+    /// \exclude return
+    template <typename Func, typename... Rest>
+    auto pipe(Func&& f, Rest&&... rest) &&
+#    if !TYPE_SAFE_USE_RETURN_TYPE_DEDUCTION
+        -> rebind<decltype(detail::pipe_invoke(std::move(*this).value(), std::forward<Func>(f),
+                                               std::forward<Rest>(rest)...))>
+#    endif
+    {
+        using return_type = decltype(detail::pipe_invoke(std::move(*this).value(),
+                                                         std::forward<Func>(f),
+                                                         std::forward<Rest>(rest)...));
+        if (has_value())
+            return rebind<return_type>(detail::pipe_invoke(std::move(*this).value(),
+                                                           std::forward<Func>(f),
+                                                           std::forward<Rest>(rest)...));
+        else
+            return static_cast<rebind<return_type>>(nullopt);
+    }
+
+    /// \unique_name *pipe_rvalue_const
+    /// \group pipe
+    /// \exclude return
+    template <typename Func, typename... Rest>
+    auto pipe(Func&& f, Rest&&... rest) const&&
+#    if !TYPE_SAFE_USE_RETURN_TYPE_DEDUCTION
+        -> rebind<decltype(detail::pipe_invoke(std::move(*this).value(), std::forward<Func>(f),
+                                               std::forward<Rest>(rest)...))>
+#    endif
+    {
+        using return_type = decltype(detail::pipe_invoke(std::move(*this).value(),
+                                                         std::forward<Func>(f),
+                                                         std::forward<Rest>(rest)...));
+        if (has_value())
+            return rebind<return_type>(detail::pipe_invoke(std::move(*this).value(),
+                                                           std::forward<Func>(f),
+                                                           std::forward<Rest>(rest)...));
+        else
+            return static_cast<rebind<return_type>>(nullopt);
+    }
+#endif
+
+    /// In-place map.
+    /// \effects If the optional contains a value,
+    /// calls the function with the value followed by the additional arguments perfectly forwarded,
+    /// and assigns the result back to the stored value.
+    /// Otherwise does nothing.
+    /// \returns A reference to the optional.
+    /// \notes Unlike [ts::basic_optional::map]() no new optional is created,
+    /// the stored object is mutated through the storage directly.
+    /// This allows a `value_type` like `std::string` to reuse its buffer
+    /// in same-type transformation chains.
+    /// \requires The result of the function must be the `value_type` itself.
+    /// \synopsis_return basic_optional&
+    template <typename Func, typename... Args>
+    auto map_in_place(Func&& f, Args&&... args) TYPE_SAFE_LVALUE_REF -> typename std::enable_if<
+        std::is_same<typename std::decay<decltype(detail::map_invoke(
+                         std::forward<Func>(f), std::declval<value_type&>(),
+                         std::forward<Args>(args)...))>::type,
+                     value_type>::value,
+        basic_optional&>::type
+    {
+        if (has_value())
+            get_storage().get_value()
+                = detail::map_invoke(std::forward<Func>(f), get_storage().get_value(),
+                                     std::forward<Args>(args)...);
+        return *this;
+    }
 };
 
 /// \entity TYPE_SAFE_DETAIL_MAKE_OP
 /// \exclude
 #define TYPE_SAFE_DETAIL_MAKE_OP(Op, Expr, Expr2)                                                  \
     template <class StoragePolicy>                                                                 \
-    bool operator Op(const basic_optional<StoragePolicy>& lhs, nullopt_t)                          \
+    TYPE_SAFE_CONSTEXPR20 bool operator Op(const basic_optional<StoragePolicy>& lhs, nullopt_t)                          \
     {                                                                                              \
         return (void)lhs, Expr;                                                                    \
     } /** \group optional_comp_null */                                                             \
     template <class StoragePolicy>                                                                 \
-    bool operator Op(nullopt_t, const basic_optional<StoragePolicy>& rhs)                          \
+    TYPE_SAFE_CONSTEXPR20 bool operator Op(nullopt_t, const basic_optional<StoragePolicy>& rhs)                          \
     {                                                                                              \
         return (void)rhs, Expr2;                                                                   \
     }
@@ -600,7 +806,7 @@ TYPE_SAFE_DETAIL_MAKE_OP(>=, true, !rhs.has_value())
 /// \exclude
 #define TYPE_SAFE_DETAIL_MAKE_OP(Op, Expr, Expr2)                                                  \
     template <class StoragePolicy, typename U>                                                     \
-    auto operator Op(const basic_optional<StoragePolicy>& lhs, const U& rhs)                       \
+    TYPE_SAFE_CONSTEXPR20 auto operator Op(const basic_optional<StoragePolicy>& lhs, const U& rhs)                       \
         ->decltype(typename StoragePolicy::value_type(lhs.value()) Op rhs)                         \
     {                                                                                              \
         using value_type = typename StoragePolicy::value_type;                                     \
@@ -609,7 +815,7 @@ TYPE_SAFE_DETAIL_MAKE_OP(>=, true, !rhs.has_value())
     /** \synopsis_return bool                                                                      \
      * \group optional_comp_value */                                                               \
     template <class StoragePolicy, typename U>                                                     \
-    auto operator Op(const U& lhs, const basic_optional<StoragePolicy>& rhs)                       \
+    TYPE_SAFE_CONSTEXPR20 auto operator Op(const U& lhs, const basic_optional<StoragePolicy>& rhs)                       \
         ->decltype(lhs Op typename StoragePolicy::value_type(rhs.value()))                         \
     {                                                                                              \
         using value_type = typename StoragePolicy::value_type;                                     \
@@ -661,7 +867,7 @@ TYPE_SAFE_DETAIL_MAKE_OP(>=, lhs.has_value() && value_type(lhs.value()) >= rhs,
 /// \exclude
 #define TYPE_SAFE_DETAIL_MAKE_OP(Op)                                                               \
     template <class StoragePolicy>                                                                 \
-    auto operator Op(const basic_optional<StoragePolicy>& lhs,                                     \
+    TYPE_SAFE_CONSTEXPR20 auto operator Op(const basic_optional<StoragePolicy>& lhs,                                     \
                      const basic_optional<StoragePolicy>& rhs)                                     \
         ->decltype(lhs.value() Op rhs.value())                                                     \
     {                                                                                              \
@@ -715,6 +921,8 @@ void with(Optional&& opt, Func&& f, Args&&... additional_args)
 /// implementation.
 ///
 /// It uses [std::aligned_storage]() and a `bool` flag whether a value was created.
+/// If [TYPE_SAFE_USE_CONSTEXPR20]() is true, the storage is a union instead,
+/// so the optional can be created and accessed in constant expressions.
 /// \requires `T` must not be a reference.
 /// \module optional
 /// \output_section Optional
@@ -735,7 +943,7 @@ public:
     using rebind = direct_optional_storage<U>;
 
     /// \effects Initializes it in the state without value.
-    direct_optional_storage() noexcept : empty_(true) {}
+    TYPE_SAFE_CONSTEXPR20 direct_optional_storage() noexcept : empty_(true) {}
 
     /// \effects Calls the constructor of `value_type` by perfectly forwarding `args`.
     /// Afterwards `has_value()` will return `true`.
@@ -744,24 +952,28 @@ public:
     /// in overload resolution unless `value_type` is constructible from `args`. \synopsis_return
     /// void
     template <typename... Args>
-    auto create_value(Args&&... args) ->
+    TYPE_SAFE_CONSTEXPR20 auto create_value(Args&&... args) ->
         typename std::enable_if<std::is_constructible<value_type, Args&&...>::value>::type
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        std::construct_at(std::addressof(storage_.value), std::forward<Args>(args)...);
+#else
         ::new (as_void()) value_type(std::forward<Args>(args)...);
+#endif
         empty_ = false;
     }
 
     /// \effects Creates a value by copy(1)/move(2) constructing from the value stored in `other`,
     /// if there is any.
     /// \group create_value
-    void create_value(const direct_optional_storage& other)
+    TYPE_SAFE_CONSTEXPR20 void create_value(const direct_optional_storage& other)
     {
         if (other.has_value())
             create_value(other.get_value());
     }
 
     /// \group create_value
-    void create_value(direct_optional_storage&& other)
+    TYPE_SAFE_CONSTEXPR20 void create_value(direct_optional_storage&& other)
     {
         if (other.has_value())
             create_value(std::move(other.get_value()));
@@ -780,7 +992,7 @@ public:
     /// \exclude
     template <typename Dummy = T,
               typename       = typename std::enable_if<std::is_copy_assignable<Dummy>::value>::type>
-    void copy_value(const direct_optional_storage& other)
+    TYPE_SAFE_CONSTEXPR20 void copy_value(const direct_optional_storage& other)
     {
         if (has_value())
         {
@@ -801,7 +1013,7 @@ public:
     /// \exclude
     template <typename Dummy                                                             = T,
               typename std::enable_if<!std::is_copy_assignable<Dummy>::value, int>::type = 0>
-    void copy_value(const direct_optional_storage& other)
+    TYPE_SAFE_CONSTEXPR20 void copy_value(const direct_optional_storage& other)
     {
         if (has_value())
             destroy_value();
@@ -819,7 +1031,7 @@ public:
     /// \exclude
     template <typename Dummy = T,
               typename       = typename std::enable_if<std::is_move_assignable<Dummy>::value>::type>
-    void copy_value(direct_optional_storage&& other)
+    TYPE_SAFE_CONSTEXPR20 void copy_value(direct_optional_storage&& other)
     {
         if (has_value())
         {
@@ -839,7 +1051,7 @@ public:
     /// \exclude
     template <typename Dummy                                                             = T,
               typename std::enable_if<!std::is_move_assignable<Dummy>::value, int>::type = 0>
-    void copy_value(direct_optional_storage&& other)
+    TYPE_SAFE_CONSTEXPR20 void copy_value(direct_optional_storage&& other)
     {
         if (has_value())
             destroy_value();
@@ -847,7 +1059,7 @@ public:
     }
 
     /// \effects Swaps the value with the value in `other`.
-    void swap_value(direct_optional_storage& other)
+    TYPE_SAFE_CONSTEXPR20 void swap_value(direct_optional_storage& other)
     {
         if (has_value() && other.has_value())
         {
@@ -869,14 +1081,18 @@ public:
     /// \effects Calls the destructor of `value_type`.
     /// Afterwards `has_value()` will return `false`.
     /// \requires `has_value() == true`.
-    void destroy_value() noexcept
+    TYPE_SAFE_CONSTEXPR20 void destroy_value() noexcept
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        std::destroy_at(std::addressof(storage_.value));
+#else
         get_value().~value_type();
+#endif
         empty_ = true;
     }
 
     /// \returns Whether or not there is a value stored.
-    bool has_value() const noexcept
+    TYPE_SAFE_CONSTEXPR20 bool has_value() const noexcept
     {
         return !empty_;
     }
@@ -884,28 +1100,44 @@ public:
     /// \returns A (`const`) (rvalue) reference to the stored value.
     /// \requires `has_value() == true`.
     /// \group value
-    lvalue_reference get_value() TYPE_SAFE_LVALUE_REF noexcept
+    TYPE_SAFE_CONSTEXPR20 lvalue_reference get_value() TYPE_SAFE_LVALUE_REF noexcept
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        return storage_.value;
+#else
         return *static_cast<value_type*>(as_void());
+#endif
     }
 
     /// \group value
-    const_lvalue_reference get_value() const TYPE_SAFE_LVALUE_REF noexcept
+    TYPE_SAFE_CONSTEXPR20 const_lvalue_reference get_value() const TYPE_SAFE_LVALUE_REF noexcept
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        return storage_.value;
+#else
         return *static_cast<const value_type*>(as_void());
+#endif
     }
 
 #if TYPE_SAFE_USE_REF_QUALIFIERS
     /// \group value
-    rvalue_reference get_value() && noexcept
+    TYPE_SAFE_CONSTEXPR20 rvalue_reference get_value() && noexcept
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        return std::move(storage_.value);
+#else
         return std::move(*static_cast<value_type*>(as_void()));
+#endif
     }
 
     /// \group value
-    const_rvalue_reference get_value() const&& noexcept
+    TYPE_SAFE_CONSTEXPR20 const_rvalue_reference get_value() const&& noexcept
     {
+#if TYPE_SAFE_USE_CONSTEXPR20
+        return std::move(storage_.value);
+#else
         return std::move(*static_cast<const value_type*>(as_void()));
+#endif
     }
 #endif
 
@@ -916,7 +1148,7 @@ public:
               typename
               = typename std::enable_if<std::is_copy_constructible<value_type>::value
                                         && std::is_convertible<U&&, value_type>::value>::type>
-    value_type get_value_or(U&& u) const TYPE_SAFE_LVALUE_REF
+    TYPE_SAFE_CONSTEXPR20 value_type get_value_or(U&& u) const TYPE_SAFE_LVALUE_REF
     {
         return has_value() ? get_value() : static_cast<value_type>(std::forward<U>(u));
     }
@@ -929,13 +1161,34 @@ public:
               typename
               = typename std::enable_if<std::is_move_constructible<value_type>::value
                                         && std::is_convertible<U&&, value_type>::value>::type>
-    value_type get_value_or(U&& u) &&
+    TYPE_SAFE_CONSTEXPR20 value_type get_value_or(U&& u) &&
     {
         return has_value() ? std::move(get_value()) : static_cast<value_type>(std::forward<U>(u));
     }
 #endif
 
 private:
+#if TYPE_SAFE_USE_CONSTEXPR20
+    // A union whose value member is activated with std::construct_at(),
+    // which - unlike placement new into a byte buffer - may appear in a constant expression.
+    // The special members are trivial whenever those of value_type are,
+    // so the layout and copy semantics of the policy do not change.
+    union storage_t
+    {
+        unsigned char empty_state;
+        value_type    value;
+
+        constexpr storage_t() noexcept : empty_state() {}
+
+        // the value (if any) is destroyed by the policy, never by the union
+        ~storage_t()
+            requires std::is_trivially_destructible_v<value_type>
+        = default;
+        constexpr ~storage_t() noexcept {}
+    };
+
+    storage_t storage_;
+#else
     void* as_void() noexcept
     {
         return static_cast<void*>(&storage_);
@@ -947,7 +1200,8 @@ private:
     }
 
     alignas(value_type) unsigned char storage_[sizeof(value_type)];
-    bool      empty_;
+#endif
+    bool empty_;
 };
 
 /// A [ts::basic_optional]() that uses [ts::direct_optional_storage<T>]().
@@ -966,7 +1220,7 @@ using optional_for = basic_optional<direct_optional_storage<int>>::rebind<T>;
 /// \returns A new [ts::optional<T>]() storing a copy of `t`.
 /// \module optional
 template <typename T>
-optional<typename std::decay<T>::type> make_optional(T&& t)
+TYPE_SAFE_CONSTEXPR20 optional<typename std::decay<T>::type> make_optional(T&& t)
 {
     return std::forward<T>(t);
 }
@@ -974,7 +1228,7 @@ optional<typename std::decay<T>::type> make_optional(T&& t)
 /// \returns A new [ts::optional<T>]() with a value created by perfectly forwarding `args` to the
 /// constructor. \module optional
 template <typename T, typename... Args>
-optional<T> make_optional(Args&&... args)
+TYPE_SAFE_CONSTEXPR20 optional<T> make_optional(Args&&... args)
 {
     optional<T> result;
     result.emplace(std::forward<Args>(args)...);
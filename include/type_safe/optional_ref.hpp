@@ -5,6 +5,13 @@
 #ifndef TYPE_SAFE_OPTIONAL_REF_HPP_INCLUDED
 #define TYPE_SAFE_OPTIONAL_REF_HPP_INCLUDED
 
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <cstdint>
+#endif
+
 #include <type_safe/optional.hpp>
 #include <type_safe/reference.hpp>
 
@@ -274,6 +281,183 @@ optional<T> move(const optional_xvalue_ref<T>& ref) noexcept(
 {
     return ref.has_value() ? type_safe::make_optional(ref.value()) : nullopt;
 }
+
+/// \exclude
+namespace detail
+{
+    template <class Base>
+    const char*& offset_base() noexcept
+    {
+        static const char* base = nullptr;
+        return base;
+    }
+} // namespace detail
+
+/// \effects Registers the base address that the offsets of every
+/// [ts::optional_offset_ref]() with tag `Base` refer to.
+/// \notes This is typically called once when the arena is created;
+/// all targets of such references must live inside it.
+/// \module optional
+template <class Base>
+void set_offset_base(const void* base) noexcept
+{
+    detail::offset_base<Base>() = static_cast<const char*>(base);
+}
+
+/// A `StoragePolicy` for [ts::basic_optional]() that compresses an optional reference
+/// to a 32 bit offset from a base address registered for the tag `Base`.
+///
+/// It exposes the same reference semantics as [ts::reference_optional_storage]():
+/// `value()` returns `T&`, `value_or()` takes and returns lvalues, rvalues cannot be bound.
+/// Halving the size of a nullable reference doubles how many of them fit a cache line,
+/// which matters for pointer-heavy structures with millions of edges.
+/// \requires All bound objects must live within 2^32 - 2 bytes after the registered base,
+/// and the base must be registered via [ts::set_offset_base]() before binding.
+/// \module optional
+template <typename T, class Base>
+class offset_ref_optional_storage
+{
+    static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+    static constexpr std::uint32_t invalid_offset = std::uint32_t(-1);
+
+    struct prevent_rvalues
+    {};
+
+public:
+    using value_type             = object_ref<T>;
+    using lvalue_reference       = T&;
+    using const_lvalue_reference = lvalue_reference;
+    /// \exclude target
+    using rvalue_reference       = prevent_rvalues;
+    using const_rvalue_reference = rvalue_reference;
+
+    template <typename U>
+    using rebind = offset_ref_optional_storage<U, Base>;
+
+    /// \effects Creates it without a bound reference.
+    offset_ref_optional_storage() noexcept : offset_(invalid_offset) {}
+
+    /// \effects Binds the reference to the same target as in `other`.
+    void create_value(const offset_ref_optional_storage& other) noexcept
+    {
+        offset_ = other.offset_;
+    }
+
+    /// \effects Binds the reference to the target of `other`.
+    void create_value(const object_ref<T>& other) noexcept
+    {
+        assign_pointer(other.operator->());
+    }
+
+    /// \effects Same as `destroy_value()`.
+    void create_value(std::nullptr_t) noexcept
+    {
+        destroy_value();
+    }
+
+    /// \effects Binds the reference to `obj`.
+    /// \notes This function only participates in overload resolution, if `U` is a reference
+    /// compatible with `T`. \param 1 \exclude
+    template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+    void create_value_explicit(U& obj) noexcept
+    {
+        assign_pointer(&obj);
+    }
+
+    void create_value_explicit(T&&) = delete;
+
+    /// \effects Binds the reference to the same target as in `other`.
+    void copy_value(const offset_ref_optional_storage& other) noexcept
+    {
+        offset_ = other.offset_;
+    }
+
+    /// \effects Swaps the references, i.e. rebinds them, no value change.
+    void swap_value(offset_ref_optional_storage& other) noexcept
+    {
+        std::swap(offset_, other.offset_);
+    }
+
+    /// \effects Unbinds the reference.
+    void destroy_value() noexcept
+    {
+        offset_ = invalid_offset;
+    }
+
+    /// \returns `true` if the reference is bound, `false` otherwise.
+    bool has_value() const noexcept
+    {
+        return offset_ != invalid_offset;
+    }
+
+    /// \returns The target of the reference.
+    lvalue_reference get_value() const noexcept
+    {
+        return *pointer_to(offset_);
+    }
+
+    /// \returns Either `get_value()` or `other`.
+    lvalue_reference get_value_or(lvalue_reference other) const noexcept
+    {
+        return has_value() ? get_value() : other;
+    }
+
+    lvalue_reference get_value_or(T&&) const = delete;
+
+private:
+    static const char* base() noexcept
+    {
+        return detail::offset_base<Base>();
+    }
+
+    void assign_pointer(T* ptr) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(base() != nullptr, detail::precondition_error_handler{},
+                                "offset base not registered");
+        auto diff = reinterpret_cast<const char*>(ptr) - base();
+        // compare against the sentinel in the unsigned 64 bit domain;
+        // on 32 bit targets std::ptrdiff_t(invalid_offset) would be -1
+        TYPE_SAFE_DETAIL_ASSERT(diff >= 0 && std::uint64_t(diff) < std::uint64_t(invalid_offset),
+                                detail::precondition_error_handler{}, "object outside the arena");
+        offset_ = std::uint32_t(diff);
+    }
+
+    static T* pointer_to(std::uint32_t offset) noexcept
+    {
+        return reinterpret_cast<T*>(const_cast<char*>(base()) + offset);
+    }
+
+    std::uint32_t offset_;
+};
+
+/// A [ts::basic_optional]() that uses [ts::offset_ref_optional_storage]().
+/// It is an optional reference compressed to a 32 bit offset from the base
+/// registered for the tag `Base`.
+/// \notes `T` is the type without the reference, i.e. `optional_offset_ref<node, my_arena>`.
+/// \module optional
+template <typename T, class Base>
+using optional_offset_ref = basic_optional<offset_ref_optional_storage<T, Base>>;
+
+/// \returns A [ts::optional_offset_ref]() to the given object.
+/// \module optional
+/// \group opt_offset_ref
+/// \param 2
+/// \exclude
+template <class Base, typename T,
+          typename = typename std::enable_if<!std::is_pointer<T>::value>::type>
+optional_offset_ref<T, Base> opt_offset_ref(T& ref) noexcept
+{
+    return optional_offset_ref<T, Base>(ref);
+}
+
+/// \returns A [ts::optional_offset_ref]() to the pointee of `ptr` or `nullopt`.
+/// \group opt_offset_ref
+template <class Base, typename T>
+optional_offset_ref<T, Base> opt_offset_ref(T* ptr) noexcept
+{
+    return ptr ? optional_offset_ref<T, Base>(*ptr) : nullopt;
+}
 } // namespace type_safe
 
 #endif // TYPE_SAFE_OPTIONAL_REF_HPP_INCLUDED
@@ -0,0 +1,222 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
+#define TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#endif
+
+#include <type_safe/integer.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+/// A vector of optional values in structure of arrays layout.
+///
+/// Unlike a `std::vector<ts::optional<T>>`, the values are stored contiguously
+/// and the presence flags in a separate packed bitmap.
+/// A column of `optional<double>` thus needs half the memory,
+/// and presence scans become a popcount loop over the bitmap
+/// instead of a strided byte walk over the elements.
+/// Elements without a value hold a value initialized `T`.
+/// \requires `T` must be default constructible and must not be a reference.
+/// \module optional
+template <typename T>
+class optional_vector
+{
+    static_assert(!std::is_reference<T>::value,
+                  "T must not be a reference; use optional_ref<T> for that");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    //=== modifiers ===//
+    /// \effects Conservatively allocates memory for at least `n` elements and presence bits.
+    void reserve(size_type n)
+    {
+        values_.reserve(n);
+        bitmap_.reserve(n / bits_per_word + 1u);
+    }
+
+    /// \effects Destroys all elements.
+    void clear() noexcept
+    {
+        values_.clear();
+        bitmap_.clear();
+    }
+
+    /// \effects Appends an element that contains a copy (1)/move (2) of `value`,
+    /// or no value (3).
+    /// \group push_back
+    void push_back(const T& value)
+    {
+        grow_bitmap();
+        values_.push_back(value);
+        bitmap_[word_index(values_.size() - 1u)] |= word_mask(values_.size() - 1u);
+    }
+
+    /// \group push_back
+    void push_back(T&& value)
+    {
+        grow_bitmap();
+        values_.push_back(std::move(value));
+        bitmap_[word_index(values_.size() - 1u)] |= word_mask(values_.size() - 1u);
+    }
+
+    /// \group push_back
+    void push_back(nullopt_t)
+    {
+        grow_bitmap();
+        values_.emplace_back();
+    }
+
+    /// \effects Removes the last element.
+    /// \requires `empty() == false`.
+    void pop_back() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!empty(), detail::precondition_error_handler{});
+        values_.pop_back();
+        bitmap_[word_index(values_.size())] &= ~word_mask(values_.size());
+        if (bitmap_.size() * bits_per_word >= values_.size() + bits_per_word)
+            bitmap_.pop_back();
+    }
+
+    /// \effects Creates the value of the element at index `i`
+    /// by perfectly forwarding `args` to the constructor of `T`,
+    /// destroying any value it contained before.
+    /// \requires `i < size()`.
+    template <typename... Args>
+    void emplace(size_type i, Args&&... args)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{});
+        values_[i] = T(std::forward<Args>(args)...);
+        bitmap_[word_index(i)] |= word_mask(i);
+    }
+
+    /// \effects Destroys the value of the element at index `i`, if there is any,
+    /// by resetting it to a value initialized `T`.
+    /// \requires `i < size()`.
+    void reset(size_type i)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{});
+        if (has_value_bit(i))
+        {
+            values_[i] = T();
+            bitmap_[word_index(i)] &= ~word_mask(i);
+        }
+    }
+
+    //=== observers ===//
+    /// \returns The number of elements, with or without a value.
+    size_type size() const noexcept
+    {
+        return values_.size();
+    }
+
+    /// \returns Whether there are no elements at all.
+    bool empty() const noexcept
+    {
+        return values_.empty();
+    }
+
+    /// \returns A [ts::optional_ref]() to the element at index `i`,
+    /// that is `nullopt` if the element does not contain a value.
+    /// \requires `i < size()`.
+    /// \group subscript
+    optional_ref<T> operator[](size_type i) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{});
+        return has_value_bit(i) ? optional_ref<T>(values_[i]) : nullopt;
+    }
+
+    /// \group subscript
+    optional_ref<const T> operator[](size_type i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{});
+        return has_value_bit(i) ? optional_ref<const T>(values_[i]) : nullopt;
+    }
+
+    /// \returns The number of elements that contain a value,
+    /// computed as a popcount over the presence bitmap.
+    size_type count() const noexcept
+    {
+        auto result = size_type(0u);
+        for (auto word : bitmap_)
+            result += size_type(detail::popcount_impl(word));
+        return result;
+    }
+
+    //=== bulk operations ===//
+    /// \effects Calls `f` with a reference to every element that contains a value, in order.
+    /// \notes Only the bitmap is scanned to find the elements,
+    /// elements without a value are never touched.
+    /// \group for_each_present
+    template <typename Func>
+    void for_each_present(Func&& f)
+    {
+        for (auto w = size_type(0u); w != bitmap_.size(); ++w)
+            for (auto word = bitmap_[w]; word != 0u; word &= word - 1u)
+                f(values_[w * bits_per_word + size_type(detail::countr_zero_impl(word))]);
+    }
+
+    /// \group for_each_present
+    template <typename Func>
+    void for_each_present(Func&& f) const
+    {
+        for (auto w = size_type(0u); w != bitmap_.size(); ++w)
+            for (auto word = bitmap_[w]; word != 0u; word &= word - 1u)
+                f(values_[w * bits_per_word + size_type(detail::countr_zero_impl(word))]);
+    }
+
+    /// \effects Fills `out` with the value of every element in order,
+    /// using `fallback` for the elements that do not contain one.
+    /// \notes The loop selects between value and fallback without branching on presence,
+    /// so the compiler can vectorize it.
+    /// \requires `out.size() >= size()`.
+    void value_or(const T& fallback, const array_ref<T>& out) const
+    {
+        TYPE_SAFE_DETAIL_ASSERT(out.size() >= size(), detail::precondition_error_handler{});
+        auto ptr = out.data();
+        for (auto i = size_type(0u); i != values_.size(); ++i)
+            ptr[i] = has_value_bit(i) ? values_[i] : fallback;
+    }
+
+private:
+    static constexpr size_type bits_per_word = 64u;
+
+    static size_type word_index(size_type i) noexcept
+    {
+        return i / bits_per_word;
+    }
+
+    static std::uint64_t word_mask(size_type i) noexcept
+    {
+        return std::uint64_t(1) << (i % bits_per_word);
+    }
+
+    bool has_value_bit(size_type i) const noexcept
+    {
+        return (bitmap_[word_index(i)] & word_mask(i)) != 0u;
+    }
+
+    void grow_bitmap()
+    {
+        if (bitmap_.size() * bits_per_word <= values_.size())
+            bitmap_.push_back(0u);
+    }
+
+    std::vector<T>             values_;
+    std::vector<std::uint64_t> bitmap_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_OPTIONAL_VECTOR_HPP_INCLUDED
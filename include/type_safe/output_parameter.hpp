@@ -8,6 +8,7 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <cstddef>
 #include <new>
 #endif
 
@@ -128,7 +129,7 @@ public:
             is_normal_ptr_ = true;
         }
 
-        DEBUG_ASSERT(is_normal_ptr_, detail::assert_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(is_normal_ptr_, detail::assert_handler{});
         return *static_cast<T*>(ptr_);
     }
 
@@ -163,6 +164,126 @@ output_parameter<T> out(deferred_construction<T>& o) noexcept
 {
     return output_parameter<T>(o);
 }
+
+/// A bulk output parameter writing into uninitialized contiguous storage.
+///
+/// While [ts::output_parameter]() transports a single object out of a function,
+/// this transports a sequence:
+/// the caller provides uninitialized memory with space for `capacity` objects,
+/// the function creates them in-place one after the other with `emplace_back()`.
+/// Like the scalar version it is write-only — elements cannot be read back through the buffer —
+/// and no object is ever default constructed just to be overwritten.
+///
+/// The buffer owns the objects it has created:
+/// they are destroyed in reverse order when it goes out of scope,
+/// unless the caller took ownership of the initialized prefix with `release()`.
+template <typename T>
+class output_buffer
+{
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+    //=== constructors/destructor ===//
+    /// \effects Creates it giving it uninitialized `storage` with space for `capacity` objects.
+    /// \requires `storage` must be suitably aligned for `T`
+    /// and must live as long as the buffer or the released objects are used.
+    explicit output_buffer(void* storage, size_type capacity) noexcept
+    : storage_(static_cast<T*>(storage)), capacity_(capacity), written_(0u), released_(false)
+    {}
+
+    /// \group delete_copy
+    output_buffer(const output_buffer&) = delete;
+
+    /// \effects Moves the buffer.
+    /// This will put `other` in an invalid state, it must not be used afterwards.
+    /// \notes This constructor is only there because guaranteed copy elision isn't available
+    /// and otherwise the `out_buffer()` function could not be implemented.
+    /// It is not intended to use it otherwise.
+    output_buffer(output_buffer&& other) noexcept
+    : storage_(other.storage_), capacity_(other.capacity_), written_(other.written_),
+      released_(other.released_)
+    {
+        other.storage_  = nullptr;
+        other.released_ = true;
+    }
+
+    /// \effects Destroys all objects written so far in reverse order,
+    /// unless the caller took ownership with `release()`.
+    ~output_buffer() noexcept
+    {
+        if (!released_)
+            for (auto i = written_; i != 0u; --i)
+                storage_[i - 1u].~T();
+    }
+
+    /// \group delete_copy
+    output_buffer& operator=(const output_buffer&) = delete;
+    /// \group delete_copy
+    output_buffer& operator=(output_buffer&&) = delete;
+
+    //=== modifiers ===//
+    /// \effects Creates the next object in-place in the storage,
+    /// forwarding `args` to the constructor.
+    /// \returns A reference to the object that was created.
+    /// \throws Anything thrown by the constructor of `T`,
+    /// in which case nothing has been written.
+    /// \requires `written() < capacity()` and ownership must not have been released.
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!released_, detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(written_ < capacity_, detail::precondition_error_handler{});
+        auto ptr = ::new (static_cast<void*>(storage_ + written_)) T(std::forward<Args>(args)...);
+        ++written_;
+        return *ptr;
+    }
+
+    /// \effects Transfers ownership of the objects written so far to the caller,
+    /// the buffer will no longer destroy them.
+    /// \returns A pointer to the first object, `written()` many objects follow contiguously.
+    /// \requires Ownership must not have been released already,
+    /// this is the single handoff to the caller.
+    T* release() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!released_, detail::precondition_error_handler{});
+        released_ = true;
+        return storage_;
+    }
+
+    //=== observers ===//
+    /// \returns The number of objects written so far.
+    size_type written() const noexcept
+    {
+        return written_;
+    }
+
+    /// \returns The number of objects the storage has space for.
+    size_type capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /// \returns `true` if no more objects can be written, `false` otherwise.
+    bool full() const noexcept
+    {
+        return written_ == capacity_;
+    }
+
+private:
+    T*        storage_;
+    size_type capacity_;
+    size_type written_;
+    bool      released_;
+};
+
+/// \returns A new [ts::output_buffer]() writing up to `capacity` objects of type `T` into
+/// `storage`. \requires As for the constructor of [ts::output_buffer]().
+template <typename T>
+output_buffer<T> out_buffer(void* storage, std::size_t capacity) noexcept
+{
+    return output_buffer<T>(storage, capacity);
+}
 } // namespace type_safe
 
 #endif // TYPE_SAFE_OUTPUT_PARAMETER_HPP_INCLUDED
@@ -0,0 +1,283 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_PACKED_BOOL_VECTOR_HPP_INCLUDED
+#define TYPE_SAFE_PACKED_BOOL_VECTOR_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <cstdint>
+#    include <vector>
+#endif
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/detail/assert.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    inline std::size_t popcount(std::uint64_t x) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ull);
+        x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<std::size_t>((x * 0x0101010101010101ull) >> 56);
+#endif
+    }
+} // namespace detail
+
+/// A vector of boolean flags in packed 1-bit storage.
+///
+/// Unlike `std::vector<ts::boolean>`, which spends a byte per flag,
+/// each flag occupies a single bit of a 64 bit word,
+/// and the aggregate queries and logical operations work a word at a time,
+/// so selection vectors shrink eightfold and combine via bitwise instructions
+/// instead of element-wise branches.
+/// Individual flags are read and written as [ts::boolean]() through a proxy.
+/// \notes The logical operations require vectors of the same size;
+/// the unused bits of the last word are always kept `false`.
+class packed_bool_vector
+{
+    static constexpr std::size_t bits_per_word = 64u;
+
+public:
+    using size_type = std::size_t;
+
+    /// A proxy for a single flag.
+    class reference
+    {
+    public:
+        /// \returns The value of the flag.
+        /// \group proxy_conversion
+        operator boolean() const noexcept
+        {
+            return boolean(((*word_ >> bit_) & 1u) != 0u);
+        }
+
+        /// \group proxy_conversion
+        explicit operator bool() const noexcept
+        {
+            return ((*word_ >> bit_) & 1u) != 0u;
+        }
+
+        /// \effects Sets the flag to the given value.
+        reference& operator=(boolean value) noexcept
+        {
+            if (static_cast<bool>(value))
+                *word_ |= std::uint64_t(1u) << bit_;
+            else
+                *word_ &= ~(std::uint64_t(1u) << bit_);
+            return *this;
+        }
+
+    private:
+        reference(std::uint64_t* word, std::size_t bit) noexcept : word_(word), bit_(bit) {}
+
+        std::uint64_t* word_;
+        std::size_t    bit_;
+
+        friend packed_bool_vector;
+    };
+
+    //=== constructors ===//
+    /// \effects Creates it without any flags.
+    packed_bool_vector() noexcept : size_(0u) {}
+
+    /// \effects Creates it with `n` flags set to `value`.
+    explicit packed_bool_vector(size_type n, boolean value = boolean(false))
+    : words_(word_count(n), static_cast<bool>(value) ? ~std::uint64_t(0u) : std::uint64_t(0u)),
+      size_(n)
+    {
+        mask_last_word();
+    }
+
+    //=== capacity ===//
+    /// \returns Whether or not there are any flags.
+    bool empty() const noexcept
+    {
+        return size_ == 0u;
+    }
+
+    /// \returns The number of flags.
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    /// \effects Reserves storage for `n` flags.
+    void reserve(size_type n)
+    {
+        words_.reserve(word_count(n));
+    }
+
+    /// \effects Destroys all flags without releasing the storage.
+    void clear() noexcept
+    {
+        words_.clear();
+        size_ = 0u;
+    }
+
+    //=== modifiers ===//
+    /// \effects Appends a flag with the given value.
+    void push_back(boolean value)
+    {
+        if (size_ % bits_per_word == 0u)
+            words_.push_back(0u);
+        ++size_;
+        (*this)[size_ - 1u] = value;
+    }
+
+    /// \effects Removes the last flag.
+    /// \requires `empty() == false`.
+    void pop_back() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!empty(), detail::precondition_error_handler{});
+        (*this)[size_ - 1u] = boolean(false);
+        --size_;
+        if (size_ % bits_per_word == 0u)
+            words_.pop_back();
+    }
+
+    //=== access ===//
+    /// \returns A proxy (1)/the value (2) of the flag at index `i`.
+    /// \requires `i < size()`.
+    /// \group subscript
+    reference operator[](size_type i) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size_, detail::precondition_error_handler{},
+                                "index out of bounds");
+        return reference(&words_[i / bits_per_word], i % bits_per_word);
+    }
+
+    /// \group subscript
+    boolean operator[](size_type i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size_, detail::precondition_error_handler{},
+                                "index out of bounds");
+        return boolean(((words_[i / bits_per_word] >> (i % bits_per_word)) & 1u) != 0u);
+    }
+
+    //=== aggregate queries ===//
+    /// \returns The number of flags that are `true`,
+    /// computed as a popcount over the words.
+    size_type count() const noexcept
+    {
+        std::size_t n = 0u;
+        for (auto word : words_)
+            n += detail::popcount(word);
+        return n;
+    }
+
+    /// \returns Whether all flags are `true`.
+    boolean all() const noexcept
+    {
+        return boolean(count() == size_);
+    }
+
+    /// \returns Whether any flag is `true`.
+    boolean any() const noexcept
+    {
+        for (auto word : words_)
+            if (word != 0u)
+                return boolean(true);
+        return boolean(false);
+    }
+
+    /// \returns Whether no flag is `true`.
+    boolean none() const noexcept
+    {
+        return !any();
+    }
+
+    //=== logical operations ===//
+    /// \effects Combines every flag with the corresponding flag of `other`,
+    /// a word at a time.
+    /// \requires `size() == other.size()`.
+    /// \group compound_logical
+    packed_bool_vector& operator&=(const packed_bool_vector& other) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(size_ == other.size_, detail::precondition_error_handler{},
+                                "mismatched sizes");
+        for (std::size_t i = 0u; i != words_.size(); ++i)
+            words_[i] &= other.words_[i];
+        return *this;
+    }
+
+    /// \group compound_logical
+    packed_bool_vector& operator|=(const packed_bool_vector& other) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(size_ == other.size_, detail::precondition_error_handler{},
+                                "mismatched sizes");
+        for (std::size_t i = 0u; i != words_.size(); ++i)
+            words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    /// \group compound_logical
+    packed_bool_vector& operator^=(const packed_bool_vector& other) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(size_ == other.size_, detail::precondition_error_handler{},
+                                "mismatched sizes");
+        for (std::size_t i = 0u; i != words_.size(); ++i)
+            words_[i] ^= other.words_[i];
+        return *this;
+    }
+
+    /// \effects Inverts every flag, a word at a time.
+    void flip() noexcept
+    {
+        for (auto& word : words_)
+            word = ~word;
+        mask_last_word();
+    }
+
+    /// \group logical
+    friend packed_bool_vector operator&(packed_bool_vector lhs, const packed_bool_vector& rhs)
+    {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    /// \group logical
+    friend packed_bool_vector operator|(packed_bool_vector lhs, const packed_bool_vector& rhs)
+    {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    /// \group logical
+    friend packed_bool_vector operator^(packed_bool_vector lhs, const packed_bool_vector& rhs)
+    {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+private:
+    static size_type word_count(size_type n) noexcept
+    {
+        return (n + bits_per_word - 1u) / bits_per_word;
+    }
+
+    // keeps the invariant that the unused bits of the last word are false,
+    // so count() and the word-level operations never see stale bits
+    void mask_last_word() noexcept
+    {
+        auto used = size_ % bits_per_word;
+        if (used != 0u)
+            words_.back() &= (std::uint64_t(1u) << used) - 1u;
+    }
+
+    std::vector<std::uint64_t> words_;
+    size_type                  size_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_PACKED_BOOL_VECTOR_HPP_INCLUDED
@@ -0,0 +1,189 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_PERSIST_HPP_INCLUDED
+#define TYPE_SAFE_PERSIST_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <cstdint>
+#    include <cstring>
+#    include <stdexcept>
+#    include <type_traits>
+#endif
+
+#include <type_safe/constrained_type.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/reference.hpp>
+
+namespace type_safe
+{
+/// A traits class specifying whether arrays of `T` can be written to
+/// and mapped back from disk as raw bytes.
+///
+/// The primary template requires `T` to be trivially copyable and standard layout,
+/// so the object representation is the value and contains no pointers or vtables.
+/// It is specialized for [ts::constrained_type]() to additionally require a stateless
+/// constraint — per-object state like dynamic bounds cannot be reconstructed from bytes.
+/// \notes [ts::strong_typedef]() ids, [ts::bounded_type]() with static bounds
+/// and compact optionals all satisfy it out of the box.
+/// \module persist
+template <typename T>
+struct is_memcpy_safe
+: std::integral_constant<bool, std::is_trivially_copyable<T>::value
+                                   && std::is_standard_layout<T>::value>
+{};
+
+/// \exclude
+template <typename T, typename Constraint, class Verifier>
+struct is_memcpy_safe<constrained_type<T, Constraint, Verifier>>
+: std::integral_constant<bool,
+                         is_memcpy_safe<T>::value && std::is_empty<Constraint>::value
+                             && sizeof(constrained_type<T, Constraint, Verifier>) == sizeof(T)>
+{};
+
+/// \exclude
+namespace detail
+{
+    constexpr std::uint64_t fingerprint_basis = 14695981039346656037ull;
+
+    constexpr std::uint64_t fingerprint_combine(std::uint64_t fingerprint,
+                                                std::uint64_t value) noexcept
+    {
+        return (fingerprint ^ value) * 1099511628211ull;
+    }
+
+    // Re-checks the invariants of a span of untrusted bytes.
+    // The primary template has nothing to check beyond the layout,
+    // the constrained specialization sweeps the underlying values
+    // through the stateless constraint with a branch-free accumulator.
+    template <typename T>
+    struct persist_validator
+    {
+        static bool validate(const T*, std::size_t) noexcept
+        {
+            return true;
+        }
+    };
+
+    template <typename T, typename Constraint, class Verifier>
+    struct persist_validator<constrained_type<T, Constraint, Verifier>>
+    {
+        static bool validate(const constrained_type<T, Constraint, Verifier>* values,
+                             std::size_t count) noexcept
+        {
+            // the layout check of is_memcpy_safe allows viewing the values directly
+            auto raw = reinterpret_cast<const T*>(values);
+
+            Constraint constraint{};
+            auto       error = 0;
+            for (std::size_t i = 0u; i != count; ++i)
+                error |= int(!static_cast<bool>(constraint(raw[i])));
+            return error == 0;
+        }
+    };
+} // namespace detail
+
+/// \returns A fingerprint of the layout of `T` that is stored alongside a snapshot,
+/// so a span is only mapped back into a type with the same size and alignment.
+/// \notes It guards against layout drift between writer and reader,
+/// it is not a full type identity.
+/// \module persist
+template <typename T>
+constexpr std::uint64_t layout_fingerprint() noexcept
+{
+    return detail::fingerprint_combine(
+        detail::fingerprint_combine(detail::fingerprint_combine(detail::fingerprint_basis,
+                                                                sizeof(T)),
+                                    alignof(T)),
+        std::uint64_t(is_memcpy_safe<T>::value));
+}
+
+/// The header written in front of every persisted span.
+/// \module persist
+struct persist_header
+{
+    std::uint64_t fingerprint;
+    std::uint64_t count;
+};
+
+/// The exception thrown by [ts::load_span]() when the mapped bytes do not match.
+/// \module persist
+class persist_error : public std::runtime_error
+{
+public:
+    persist_error(const char* msg) : std::runtime_error(msg) {}
+};
+
+/// \returns The number of bytes [ts::store_span]() needs for `count` elements.
+/// \module persist
+template <typename T>
+constexpr std::size_t persist_size(std::size_t count) noexcept
+{
+    return sizeof(persist_header) + count * sizeof(T);
+}
+
+/// \effects Writes the header followed by the raw object representations of `values`
+/// into `memory`, which is later mapped back by [ts::load_span]().
+/// \requires `size >= persist_size<T>(values.size())`
+/// and `memory` must be suitably aligned for [ts::persist_header]().
+/// \module persist
+template <typename T>
+void store_span(const array_ref<const T>& values, void* memory, std::size_t size) noexcept
+{
+    static_assert(is_memcpy_safe<T>::value, "type cannot be persisted as raw bytes");
+
+    auto count = static_cast<std::size_t>(values.size());
+    TYPE_SAFE_DETAIL_ASSERT(size >= persist_size<T>(count), detail::precondition_error_handler{},
+                            "destination too small");
+
+    auto header = persist_header{layout_fingerprint<T>(), count};
+    std::memcpy(memory, &header, sizeof(header));
+    if (count != 0u)
+        std::memcpy(static_cast<char*>(memory) + sizeof(header), values.data(),
+                    count * sizeof(T));
+}
+
+/// \returns A typed [ts::array_ref]() viewing the persisted elements directly in `memory`,
+/// without copying them out.
+///
+/// The header fingerprint must match the layout of `T`,
+/// and for constrained types all values are swept through the constraint once,
+/// so the invariants of the wrapper types hold for the mapped span as well.
+/// \throws A [ts::persist_error]() if the bytes are truncated,
+/// the fingerprint does not match, or a value violates its constraint.
+/// \requires `memory` must be aligned for `T`; a page-aligned mapping always is.
+/// \module persist
+template <typename T>
+array_ref<const T> load_span(const void* memory, std::size_t size)
+{
+    static_assert(is_memcpy_safe<T>::value, "type cannot be persisted as raw bytes");
+
+    if (size < sizeof(persist_header))
+        TYPE_SAFE_THROW(persist_error("persisted span is truncated"));
+
+    persist_header header;
+    std::memcpy(&header, memory, sizeof(header));
+
+    if (header.fingerprint != layout_fingerprint<T>())
+        TYPE_SAFE_THROW(persist_error("persisted span has a mismatched layout fingerprint"));
+
+    // validate with a division: multiplying the untrusted count by sizeof(T) could wrap,
+    // and truncating it to std::size_t first would lose bits on 32 bit targets
+    if (header.count > std::uint64_t((size - sizeof(persist_header)) / sizeof(T)))
+        TYPE_SAFE_THROW(persist_error("persisted span is truncated"));
+    auto count = std::size_t(header.count);
+
+    auto elements
+        = reinterpret_cast<const T*>(static_cast<const char*>(memory) + sizeof(persist_header));
+    if (!detail::persist_validator<T>::validate(elements, count))
+        TYPE_SAFE_THROW(persist_error("persisted span violates a constraint"));
+
+    return array_ref<const T>(elements, count);
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_PERSIST_HPP_INCLUDED
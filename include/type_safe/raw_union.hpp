@@ -0,0 +1,393 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_RAW_UNION_HPP_INCLUDED
+#define TYPE_SAFE_RAW_UNION_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <new>
+#    include <utility>
+#    include <vector>
+#endif
+
+#include <type_safe/config.hpp>
+#include <type_safe/detail/aligned_union.hpp>
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/tagged_union.hpp>
+
+namespace type_safe
+{
+/// A [ts::tagged_union]() whose discriminant lives outside the object.
+///
+/// It only provides the storage; the caller has to remember which type is
+/// currently stored and pass the matching [ts::union_type]() to the accessors.
+/// This enables structure of arrays layouts where one packed tag array
+/// describes a separate payload array without padding every element to
+/// payload plus tag size, see [ts::tagged_array]().
+/// \notes Like the C `union` it does not automatically destroy the currently stored type,
+/// and copy operations are deleted,
+/// unless all types are trivially copyable,
+/// in which case the defaulted copy operations simply copy the bytes.
+/// \module variant
+template <typename... Types>
+class raw_union
+: detail::union_copy_control<detail::is_trivial_union<Types...>::value, Types...>
+{
+public:
+    using types = union_types<typename std::decay<Types>::type...>;
+
+    /// The id of a type, shared with the corresponding [ts::tagged_union]().
+    using type_id = typename tagged_union<Types...>::type_id;
+
+    /// A global invalid type id object.
+    static constexpr type_id invalid_type = type_id();
+
+    //=== constructors/destructors/assignment ===//
+    raw_union() noexcept = default;
+
+    /// \notes Does not destroy the currently stored type.
+    ~raw_union() noexcept = default;
+
+    //=== modifiers ===//
+    /// \effects Creates a new object of given type by perfectly forwarding `args`.
+    /// \returns The [*type_id]() of the new type;
+    /// the caller has to store it, the union does not.
+    /// \throws Anything thrown by `T`s constructor,
+    /// in which case nothing was created.
+    /// \requires The union must currently be empty,
+    /// and `T` must be a valid type and constructible from the arguments.
+    template <typename T, typename... Args>
+    type_id emplace(union_type<T>, Args&&... args)
+    {
+        constexpr auto index = type_id(union_type<T>{});
+        static_assert(get(index) != get(invalid_type), "T must not be stored in union");
+        static_assert(std::is_constructible<T, Args&&...>::value,
+                      "T not constructible from arguments");
+
+        ::new (storage_.get()) T(std::forward<Args>(args)...);
+        return index;
+    }
+
+    /// \effects Destroys the currently stored type by calling its destructor.
+    /// \requires The union must currently store an object of the given type,
+    /// as identified by the externally stored id;
+    /// unlike [ts::tagged_union]() this cannot be checked.
+    template <typename T>
+    void destroy(union_type<T> type) noexcept
+    {
+        value(type).~T();
+    }
+
+    //=== accessors ===//
+    /// \returns A (`const`) lvalue/rvalue reference to the currently stored type.
+    /// \requires The union must currently store an object of the given type,
+    /// as identified by the externally stored id;
+    /// unlike [ts::tagged_union]() this cannot be checked.
+    /// \group value
+    template <typename T>
+    T& value(union_type<T>) TYPE_SAFE_LVALUE_REF noexcept
+    {
+        return *static_cast<T*>(storage_.get());
+    }
+
+    /// \group value
+    template <typename T>
+    const T& value(union_type<T>) const TYPE_SAFE_LVALUE_REF noexcept
+    {
+        return *static_cast<const T*>(storage_.get());
+    }
+
+#if TYPE_SAFE_USE_REF_QUALIFIERS
+    /// \group value
+    template <typename T>
+    T&& value(union_type<T>) && noexcept
+    {
+        return std::move(*static_cast<T*>(storage_.get()));
+    }
+
+    /// \group value
+    template <typename T>
+    const T&& value(union_type<T>) const&& noexcept
+    {
+        return std::move(*static_cast<const T*>(storage_.get()));
+    }
+#endif
+
+private:
+    using storage_t = detail::aligned_union<Types...>;
+    storage_t storage_;
+};
+
+/// \exclude
+template <typename... Types>
+constexpr typename raw_union<Types...>::type_id raw_union<Types...>::invalid_type;
+
+/// \exclude
+namespace detail
+{
+    template <typename Func, class Union, class Types, typename... Args>
+    class with_raw_union;
+
+    template <typename Func, class Union, typename... Types, typename... Args>
+    class with_raw_union<Func, Union, union_types<Types...>, Args...>
+    {
+        using callback = void (*)(Union&&, Func&&, Args&&...);
+
+    public:
+        static void with(Union&& u, std::size_t id, Func&& func, Args&&... args)
+        {
+            // flat dispatch table indexed by the type id, entry 0 is the empty state
+            static constexpr callback table[] = {&with_empty, &with_type<Types>...};
+            table[id](std::forward<Union>(u), std::forward<Func>(func),
+                      std::forward<Args>(args)...);
+        }
+
+    private:
+        template <typename T>
+        static auto call(int, Union&& u, Func&& func, Args&&... args)
+            -> decltype(std::forward<Func>(func)(std::forward<Union>(u).value(union_type<T>{}),
+                                                 std::forward<Args>(args)...))
+        {
+            return std::forward<Func>(func)(std::forward<Union>(u).value(union_type<T>{}),
+                                            std::forward<Args>(args)...);
+        }
+
+        template <typename T>
+        static void call(short, Union&&, Func&&, Args&&...)
+        {}
+
+        static void with_empty(Union&&, Func&&, Args&&...) {}
+
+        template <typename T>
+        static void with_type(Union&& u, Func&& func, Args&&... args)
+        {
+            call<T>(0, std::forward<Union>(u), std::forward<Func>(func),
+                    std::forward<Args>(args)...);
+        }
+    };
+} // namespace detail
+
+/// \effects If `id` is invalid, does nothing.
+/// Otherwise let the union contain an object of the type identified by `id`.
+/// If the functor is callable for that type, calls its `operator()` passing it the stored object.
+/// Else does nothing.
+/// \requires `id` must be the id of the type currently stored in the union,
+/// or the invalid id if the union is empty.
+/// \group raw_union_with
+/// \module variant
+template <typename... Types, typename Func, typename... Args>
+void with(raw_union<Types...>& u, typename raw_union<Types...>::type_id id, Func&& f,
+          Args&&... additional_args)
+{
+    detail::with_raw_union<Func&&, decltype(u), typename raw_union<Types...>::types,
+                           Args&&...>::with(u, get(id), std::forward<Func>(f),
+                                            std::forward<Args>(additional_args)...);
+}
+
+/// \group raw_union_with
+template <typename... Types, typename Func, typename... Args>
+void with(const raw_union<Types...>& u, typename raw_union<Types...>::type_id id, Func&& f,
+          Args&&... additional_args)
+{
+    detail::with_raw_union<Func&&, decltype(u), typename raw_union<Types...>::types,
+                           Args&&...>::with(u, get(id), std::forward<Func>(f),
+                                            std::forward<Args>(additional_args)...);
+}
+
+/// \group raw_union_with
+template <typename... Types, typename Func, typename... Args>
+void with(raw_union<Types...>&& u, typename raw_union<Types...>::type_id id, Func&& f,
+          Args&&... additional_args)
+{
+    detail::with_raw_union<Func&&, decltype(u), typename raw_union<Types...>::types,
+                           Args&&...>::with(std::move(u), get(id), std::forward<Func>(f),
+                                            std::forward<Args>(additional_args)...);
+}
+
+/// \group raw_union_with
+template <typename... Types, typename Func, typename... Args>
+void with(const raw_union<Types...>&& u, typename raw_union<Types...>::type_id id, Func&& f,
+          Args&&... additional_args)
+{
+    detail::with_raw_union<Func&&, decltype(u), typename raw_union<Types...>::types,
+                           Args&&...>::with(std::move(u), get(id), std::forward<Func>(f),
+                                            std::forward<Args>(additional_args)...);
+}
+
+/// An array of tagged unions in structure of arrays layout.
+///
+/// It stores one packed array of tags and one packed array of [ts::raw_union]() payloads,
+/// so the payload elements are not padded to payload plus tag size
+/// and scans touch half the memory of an array of [ts::tagged_union]()s.
+/// The tags use the smallest unsigned integer able to index the types.
+/// \requires All types must be trivially copyable,
+/// as the payload array has to relocate the elements when it grows.
+/// \module variant
+template <typename... Types>
+class tagged_array
+{
+    static_assert(detail::is_trivial_union<Types...>::value,
+                  "all types must be trivially copyable");
+
+public:
+    using union_t   = raw_union<Types...>;
+    using type_id   = typename union_t::type_id;
+    using size_type = std::size_t;
+
+    //=== modifiers ===//
+    /// \effects Creates a new object of given type at the end of the array
+    /// by perfectly forwarding `args`, and stores its tag.
+    /// \throws Anything thrown by `T`s constructor or the allocation,
+    /// in which case the array is unchanged.
+    template <typename T, typename... Args>
+    void push_back(union_type<T> type, Args&&... args)
+    {
+        // grow geometrically; `reserve(size() + 1)` would request exactly that capacity
+        // and copy the whole tag array on every push
+        if (tags_.size() == tags_.capacity())
+            tags_.reserve(tags_.capacity() == 0u ? 8u : 2u * tags_.capacity());
+        unions_.emplace_back();
+        TYPE_SAFE_TRY
+        {
+            unions_.back().emplace(type, std::forward<Args>(args)...);
+        }
+        TYPE_SAFE_CATCH_ALL
+        {
+            unions_.pop_back();
+            TYPE_SAFE_RETHROW;
+        }
+        // won't throw, the capacity is already there
+        tags_.push_back(tag_type(get(type_id(type))));
+    }
+
+    /// \effects Removes the last element.
+    /// \requires The array must not be empty.
+    void pop_back() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!empty(), detail::precondition_error_handler{});
+        tags_.pop_back();
+        unions_.pop_back();
+    }
+
+    /// \effects Removes all elements.
+    void clear() noexcept
+    {
+        tags_.clear();
+        unions_.clear();
+    }
+
+    /// \effects Reserves storage for `new_capacity` elements in both arrays.
+    void reserve(size_type new_capacity)
+    {
+        tags_.reserve(new_capacity);
+        unions_.reserve(new_capacity);
+    }
+
+    //=== accessors ===//
+    /// \returns The number of elements.
+    size_type size() const noexcept
+    {
+        return unions_.size();
+    }
+
+    /// \returns `true` if there are no elements, `false` otherwise.
+    bool empty() const noexcept
+    {
+        return unions_.empty();
+    }
+
+    /// \returns `true` if the element at index `i` currently stores `T`,
+    /// `false` otherwise.
+    /// \requires `i < size()`.
+    template <typename T>
+    bool has_type(size_type i) const noexcept
+    {
+        check(i);
+        return tags_[i] == tag_type(get(type_id(union_type<T>{})));
+    }
+
+    /// \returns A (`const`) reference to the element at index `i`.
+    /// \requires `i < size()`
+    /// and the element must currently store an object of the given type.
+    /// \group array_value
+    template <typename T>
+    T& value(size_type i, union_type<T> type) noexcept
+    {
+        check(i);
+        TYPE_SAFE_DETAIL_ASSERT(has_type<T>(i), detail::precondition_error_handler{},
+                                "different type stored at index");
+        return unions_[i].value(type);
+    }
+
+    /// \group array_value
+    template <typename T>
+    const T& value(size_type i, union_type<T> type) const noexcept
+    {
+        check(i);
+        TYPE_SAFE_DETAIL_ASSERT(has_type<T>(i), detail::precondition_error_handler{},
+                                "different type stored at index");
+        return unions_[i].value(type);
+    }
+
+    /// \effects If the functor is callable for the type currently stored at index `i`,
+    /// calls its `operator()` passing it the stored object.
+    /// Else does nothing.
+    /// \requires `i < size()`.
+    /// \group array_with
+    template <typename Func, typename... Args>
+    void with(size_type i, Func&& f, Args&&... additional_args)
+    {
+        check(i);
+        detail::with_raw_union<Func&&, union_t&, typename union_t::types,
+                               Args&&...>::with(unions_[i], std::size_t(tags_[i]),
+                                                std::forward<Func>(f),
+                                                std::forward<Args>(additional_args)...);
+    }
+
+    /// \group array_with
+    template <typename Func, typename... Args>
+    void with(size_type i, Func&& f, Args&&... additional_args) const
+    {
+        check(i);
+        detail::with_raw_union<Func&&, const union_t&, typename union_t::types,
+                               Args&&...>::with(unions_[i], std::size_t(tags_[i]),
+                                                std::forward<Func>(f),
+                                                std::forward<Args>(additional_args)...);
+    }
+
+    /// \effects Calls `with(i, f, additional_args...)` for every element in order.
+    /// As the tag array is packed, the scan only touches the payloads the functor reads.
+    /// \group array_for_each
+    template <typename Func, typename... Args>
+    void for_each(Func&& f, Args&&... additional_args)
+    {
+        for (auto i = size_type(0u); i != size(); ++i)
+            with(i, f, additional_args...);
+    }
+
+    /// \group array_for_each
+    template <typename Func, typename... Args>
+    void for_each(Func&& f, Args&&... additional_args) const
+    {
+        for (auto i = size_type(0u); i != size(); ++i)
+            with(i, f, additional_args...);
+    }
+
+private:
+    void check(size_type i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{},
+                                "index out of bounds");
+    }
+
+    using tag_type = detail::compact_type_id<sizeof...(Types)>;
+
+    std::vector<union_t>  unions_;
+    std::vector<tag_type> tags_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_RAW_UNION_HPP_INCLUDED
@@ -0,0 +1,219 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_RECURSIVE_VARIANT_HPP_INCLUDED
+#define TYPE_SAFE_RECURSIVE_VARIANT_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <cstdint>
+#    include <new>
+#    include <type_traits>
+#    include <utility>
+#endif
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/variant.hpp>
+
+namespace type_safe
+{
+/// A monotonic slab allocator for tree structures.
+///
+/// `allocate()` bumps a pointer inside the current slab
+/// and grabs a new slab from the heap only when the current one is full,
+/// so building a tree costs a handful of slab allocations instead of one `malloc` per node.
+/// Individual objects are never freed;
+/// all memory is released at once when the arena is destroyed or `release()`d.
+/// \notes The arena is not copy- or moveable,
+/// references into it stay valid until `release()`.
+class monotonic_arena
+{
+public:
+    /// \effects Creates it with the given default slab size.
+    explicit monotonic_arena(std::size_t slab_size = 4096u) noexcept
+    : head_(nullptr), cur_(nullptr), end_(nullptr), slab_size_(slab_size), slab_count_(0u)
+    {}
+
+    monotonic_arena(const monotonic_arena&)            = delete;
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    ~monotonic_arena() noexcept
+    {
+        release();
+    }
+
+    /// \returns A pointer to `size` bytes with the given alignment,
+    /// allocated by bumping the slab pointer.
+    void* allocate(std::size_t size, std::size_t align)
+    {
+        auto misalign = reinterpret_cast<std::uintptr_t>(cur_) % align;
+        auto offset   = misalign == 0u ? 0u : align - misalign;
+        if (cur_ == nullptr || size + offset > std::size_t(end_ - cur_))
+        {
+            new_slab(size + align);
+            misalign = reinterpret_cast<std::uintptr_t>(cur_) % align;
+            offset   = misalign == 0u ? 0u : align - misalign;
+        }
+
+        auto memory = cur_ + offset;
+        cur_        = memory + size;
+        return memory;
+    }
+
+    /// \effects Frees all slabs at once, without invoking any destructors.
+    /// \notes This is the bulk destruction path:
+    /// only use it when the objects in the arena are trivially destructible
+    /// or their destructors do not matter.
+    void release() noexcept
+    {
+        for (auto slab = head_; slab != nullptr;)
+        {
+            auto next = slab->next;
+            ::operator delete(slab);
+            slab = next;
+        }
+        head_       = nullptr;
+        cur_        = nullptr;
+        end_        = nullptr;
+        slab_count_ = 0u;
+    }
+
+    /// \returns The number of slabs allocated from the heap so far.
+    std::size_t slab_count() const noexcept
+    {
+        return slab_count_;
+    }
+
+private:
+    struct slab_header
+    {
+        slab_header* next;
+    };
+
+    void new_slab(std::size_t min_size)
+    {
+        auto size = slab_size_ > min_size ? slab_size_ : min_size;
+
+        auto memory = static_cast<char*>(::operator new(sizeof(slab_header) + size));
+        auto header = ::new (memory) slab_header{head_};
+
+        head_ = header;
+        cur_  = memory + sizeof(slab_header);
+        end_  = cur_ + size;
+        ++slab_count_;
+    }
+
+    slab_header* head_;
+    char*        cur_;
+    char*        end_;
+    std::size_t  slab_size_;
+    std::size_t  slab_count_;
+};
+
+/// A recursive alternative type for [ts::basic_variant]().
+///
+/// It stores the value in memory allocated from a user-supplied monotonic arena,
+/// so a variant can contain itself indirectly
+/// without one heap allocation per node like a `std::unique_ptr` child would cost.
+/// Copying a wrapper copies the value into a new arena allocation,
+/// moving only transfers the pointer.
+/// If `T` is trivially destructible the destructor does nothing at all —
+/// dropping the arena is the bulk destruction of the entire tree.
+/// \requires The arena must outlive every wrapper allocated from it.
+/// \notes `T` may be an incomplete type at the point the wrapper is named,
+/// it must only be complete once a wrapper is created.
+template <typename T, class Arena = monotonic_arena>
+class recursive_wrapper
+{
+public:
+    using value_type = T;
+    using arena_type = Arena;
+
+    /// \effects Moves `value` into storage allocated from `arena`.
+    recursive_wrapper(arena_type& arena, T value)
+    : arena_(&arena), ptr_(static_cast<T*>(arena.allocate(sizeof(T), alignof(T))))
+    {
+        ::new (static_cast<void*>(ptr_)) T(std::move(value));
+    }
+
+    /// \effects Copies the value of `other` into a new allocation from the same arena.
+    recursive_wrapper(const recursive_wrapper& other)
+    : arena_(other.arena_), ptr_(static_cast<T*>(other.arena_->allocate(sizeof(T), alignof(T))))
+    {
+        ::new (static_cast<void*>(ptr_)) T(other.value());
+    }
+
+    /// \effects Transfers the value of `other` without touching the arena.
+    recursive_wrapper(recursive_wrapper&& other) noexcept : arena_(other.arena_), ptr_(other.ptr_)
+    {
+        other.ptr_ = nullptr;
+    }
+
+    /// \effects Destroys the value unless `T` is trivially destructible;
+    /// the memory itself is only reclaimed when the arena is.
+    ~recursive_wrapper() noexcept
+    {
+        if (!std::is_trivially_destructible<T>::value && ptr_ != nullptr)
+            ptr_->~T();
+    }
+
+    /// \effects Copy (1)/move (2) assigns the value.
+    /// \group assignment
+    recursive_wrapper& operator=(const recursive_wrapper& other)
+    {
+        recursive_wrapper tmp(other);
+        swap(*this, tmp);
+        return *this;
+    }
+
+    /// \group assignment
+    recursive_wrapper& operator=(recursive_wrapper&& other) noexcept
+    {
+        swap(*this, other);
+        return *this;
+    }
+
+    /// \effects Swaps the values of `a` and `b` by rebinding the pointers.
+    friend void swap(recursive_wrapper& a, recursive_wrapper& b) noexcept
+    {
+        auto arena = a.arena_;
+        a.arena_   = b.arena_;
+        b.arena_   = arena;
+
+        auto ptr = a.ptr_;
+        a.ptr_   = b.ptr_;
+        b.ptr_   = ptr;
+    }
+
+    /// \returns A reference to the stored value.
+    /// \requires The wrapper must not have been moved from.
+    /// \group value
+    T& value() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(ptr_ != nullptr, detail::precondition_error_handler{});
+        return *ptr_;
+    }
+
+    /// \group value
+    const T& value() const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(ptr_ != nullptr, detail::precondition_error_handler{});
+        return *ptr_;
+    }
+
+    /// \returns The arena the value is allocated from.
+    arena_type& arena() const noexcept
+    {
+        return *arena_;
+    }
+
+private:
+    arena_type* arena_;
+    T*          ptr_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_RECURSIVE_VARIANT_HPP_INCLUDED
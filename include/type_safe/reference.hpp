@@ -272,6 +272,88 @@ constexpr T move(const xvalue_ref<T>& obj) noexcept(std::is_nothrow_move_constru
     return *obj;
 }
 
+/// A [ts::object_ref]() whose internal pointer is `restrict` qualified.
+///
+/// By creating one the caller promises that for its entire lifetime
+/// the referenced object is not accessed through any other pointer or reference,
+/// which lets the compiler vectorize kernels taking several reference parameters
+/// the same way as hand written `T* restrict` signatures.
+/// That promise is the caller's responsibility and cannot be checked;
+/// violating it is undefined behavior.
+/// \notes It is deliberately minimal — bind it in a kernel signature, access the object —
+/// rebinding and `map()` are left to [ts::object_ref]().
+template <typename T>
+class no_alias_ref
+{
+    static_assert(!std::is_void<T>::value, "must not be void");
+    static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+    T* TYPE_SAFE_RESTRICT ptr_;
+
+public:
+    using value_type     = T;
+    using reference_type = T&;
+
+    /// \effects Binds the reference to the given object.
+    /// \notes This constructor will only participate in overload resolution
+    /// if `U` is a compatible type (i.e. non-const variant or derived type).
+    /// \group ctor
+    /// \param 1
+    /// \exclude
+    template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+    explicit constexpr no_alias_ref(U& obj) noexcept : ptr_(&obj)
+    {}
+
+    /// \group ctor
+    /// \param 1
+    /// \exclude
+    template <typename U, typename = decltype(std::declval<T*&>() = std::declval<U*>())>
+    explicit constexpr no_alias_ref(const object_ref<U>& obj) noexcept : ptr_(&*obj)
+    {}
+
+    /// \returns A native reference to the referenced object.
+    /// All accesses through it are known not to alias.
+    /// \group deref
+    constexpr reference_type get() const noexcept
+    {
+        return **this;
+    }
+
+    /// \group deref
+    constexpr reference_type operator*() const noexcept
+    {
+        return *ptr_;
+    }
+
+    /// Member access operator.
+    constexpr T* operator->() const noexcept
+    {
+        return ptr_;
+    }
+
+    /// \returns A plain [ts::object_ref]() to the same object, dropping the promise.
+    constexpr operator object_ref<T>() const noexcept
+    {
+        return object_ref<T>(*ptr_);
+    }
+};
+
+/// Creates a [ts::no_alias_ref]().
+/// \returns The reference created by forwarding the parameter to the constructor.
+/// \group no_alias_ref_ref
+template <typename T>
+constexpr no_alias_ref<T> ref_no_alias(T& obj) noexcept
+{
+    return no_alias_ref<T>(obj);
+}
+
+/// \group no_alias_ref_ref
+template <typename T>
+constexpr no_alias_ref<const T> cref_no_alias(const T& obj) noexcept
+{
+    return no_alias_ref<const T>(obj);
+}
+
 /// A reference to an array of objects of type `T`.
 ///
 /// It is a simple pointer + size pair that allows reference access to each element in the array.
@@ -335,7 +417,8 @@ public:
     /// \group range
     void assign(T* begin, T* end) noexcept
     {
-        DEBUG_ASSERT(begin <= end, detail::precondition_error_handler{}, "invalid array bounds");
+        TYPE_SAFE_DETAIL_ASSERT(begin <= end, detail::precondition_error_handler{},
+                                "invalid array bounds");
         begin_ = begin;
         size_  = static_cast<size_t>(make_unsigned(end - begin));
     }
@@ -343,8 +426,8 @@ public:
     /// \group ptr_size
     void assign(T* array, size_t size) noexcept
     {
-        DEBUG_ASSERT(size == 0u || array, detail::precondition_error_handler{},
-                     "invalid array bounds");
+        TYPE_SAFE_DETAIL_ASSERT(size == 0u || array, detail::precondition_error_handler{},
+                                "invalid array bounds");
         begin_ = array;
         size_  = size;
     }
@@ -386,8 +469,9 @@ public:
     /// \requires `i < size()`.
     reference_type operator[](index_t i) const noexcept
     {
-        DEBUG_ASSERT(static_cast<size_t&>(i) < size_, detail::precondition_error_handler{},
-                     "out of bounds array access");
+        TYPE_SAFE_DETAIL_ASSERT(static_cast<size_t&>(i) < size_,
+                                detail::precondition_error_handler{},
+                                "out of bounds array access");
         return static_cast<reference_type>(at(begin_, i));
     }
 
@@ -481,6 +565,400 @@ array_xvalue_ref<T> xref(T* array, size_t size) noexcept
     return array_xvalue_ref<T>(array, size);
 }
 
+/// \exclude
+namespace detail
+{
+    template <class StrongTypedef>
+    struct verify_underlying_layout
+    {
+        static_assert(is_strong_typedef<StrongTypedef>::value, "not a strong typedef");
+        static_assert(std::is_standard_layout<StrongTypedef>::value,
+                      "strong typedef must be standard layout to view its underlying type");
+        static_assert(sizeof(StrongTypedef) == sizeof(type_safe::underlying_type<StrongTypedef>),
+                      "strong typedef must have the size of its underlying type");
+
+        using type = type_safe::underlying_type<StrongTypedef>;
+    };
+} // namespace detail
+
+/// Creates a [ts::array_ref]() viewing an array of [ts::strong_typedef]()s as the underlying type.
+///
+/// This allows zero-copy interop with code that operates on buffers of the raw type,
+/// like syscalls or vectorized kernels,
+/// instead of an element-wise copy loop using [ts::get]().
+/// \returns A reference to the same memory range, but typed as the underlying type.
+/// \requires The strong typedef must be standard layout and have the size of its underlying type,
+/// which holds whenever the operations mixed in are the empty bases from `strong_typedef_op`;
+/// this is checked at compile time.
+/// \group underlying_array_ref
+template <class StrongTypedef>
+array_ref<typename detail::verify_underlying_layout<StrongTypedef>::type> underlying_array_ref(
+    StrongTypedef* array, size_t size) noexcept
+{
+    using underlying = typename detail::verify_underlying_layout<StrongTypedef>::type;
+    return array_ref<underlying>(reinterpret_cast<underlying*>(array), size);
+}
+
+/// \group underlying_array_ref
+template <class StrongTypedef>
+array_ref<const typename detail::verify_underlying_layout<StrongTypedef>::type>
+    underlying_array_ref(const StrongTypedef* array, size_t size) noexcept
+{
+    using underlying = typename detail::verify_underlying_layout<StrongTypedef>::type;
+    return array_ref<const underlying>(reinterpret_cast<const underlying*>(array), size);
+}
+
+/// \group underlying_array_ref
+/// \param 1
+/// \exclude
+template <class Container,
+          typename = typename std::enable_if<is_strong_typedef<
+              typename std::remove_const<typename Container::value_type>::type>::value>::type>
+auto underlying_array_ref(Container& container) noexcept
+    -> decltype(underlying_array_ref(container.data(), container.size()))
+{
+    return underlying_array_ref(container.data(), container.size());
+}
+
+/// Creates a [ts::array_ref]() viewing an array of the underlying type as a
+/// [ts::strong_typedef]().
+///
+/// This is the inverse of [ts::underlying_array_ref](),
+/// giving a typed view on a raw buffer, e.g. one filled by a `read()` syscall.
+/// \returns A reference to the same memory range, but typed as the strong typedef.
+/// \requires Same as [ts::underlying_array_ref]().
+/// \group strong_array_ref
+template <class StrongTypedef>
+array_ref<StrongTypedef> strong_array_ref(
+    typename detail::verify_underlying_layout<StrongTypedef>::type* array, size_t size) noexcept
+{
+    return array_ref<StrongTypedef>(reinterpret_cast<StrongTypedef*>(array), size);
+}
+
+/// \group strong_array_ref
+template <class StrongTypedef>
+array_ref<const StrongTypedef> strong_array_ref(
+    const typename detail::verify_underlying_layout<StrongTypedef>::type* array,
+    size_t size) noexcept
+{
+    return array_ref<const StrongTypedef>(reinterpret_cast<const StrongTypedef*>(array), size);
+}
+
+/// A reference to a two dimensional array of objects of type `T`, i.e. a matrix view.
+///
+/// It views `rows() * columns()` elements where consecutive rows are `row_stride()`
+/// elements apart, so it can also reference a rectangular block inside a larger matrix.
+/// Cache aware kernels like stencils or transposes are written against
+/// [*for_each_tile]() and [*prefetch]() instead of falling back to raw pointers
+/// to regain blocking and prefetching.
+/// \notes Like [ts::array_ref]() it isn't technically non-null, as it may be empty.
+template <typename T>
+class array_ref_2d
+{
+    static_assert(!std::is_void<T>::value, "must not be void");
+    static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+public:
+    using value_type     = T;
+    using reference_type = T&;
+
+    /// \effects Sets the reference to an empty matrix.
+    array_ref_2d(std::nullptr_t) : data_(nullptr), rows_(0u), columns_(0u), row_stride_(0u) {}
+
+    /// \effects Sets the reference to the contiguous, row major matrix beginning at `data`.
+    /// \requires `data` must not be `nullptr` unless the matrix is empty.
+    /// \group ptr_size
+    array_ref_2d(T* data, size_t rows, size_t columns) noexcept
+    : array_ref_2d(data, rows, columns, columns)
+    {}
+
+    /// \effects Sets the reference to the matrix beginning at `data`
+    /// whose rows are `row_stride` elements apart,
+    /// viewing a block inside a larger matrix.
+    /// \requires `row_stride >= columns`,
+    /// and `data` must not be `nullptr` unless the matrix is empty.
+    /// \group ptr_size
+    array_ref_2d(T* data, size_t rows, size_t columns, size_t row_stride) noexcept
+    : data_(data), rows_(rows), columns_(columns), row_stride_(row_stride)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(columns <= row_stride, detail::precondition_error_handler{},
+                                "row stride smaller than a row");
+        TYPE_SAFE_DETAIL_ASSERT(rows == 0u || columns == 0u || data,
+                                detail::precondition_error_handler{},
+                                "invalid matrix bounds");
+    }
+
+    /// \returns A pointer to the first element of the matrix.
+    /// If the matrix isn't empty, the pointer is guaranteed to be non-null.
+    T* data() const noexcept
+    {
+        return data_;
+    }
+
+    /// \returns The number of rows of the matrix.
+    size_t rows() const noexcept
+    {
+        return rows_;
+    }
+
+    /// \returns The number of columns of the matrix.
+    size_t columns() const noexcept
+    {
+        return columns_;
+    }
+
+    /// \returns The number of elements between the beginnings of consecutive rows.
+    /// It equals `columns()` if the matrix is contiguous.
+    size_t row_stride() const noexcept
+    {
+        return row_stride_;
+    }
+
+    /// \returns The number of elements viewed, i.e. `rows() * columns()`.
+    size_t size() const noexcept
+    {
+        return size_t(static_cast<std::size_t>(rows_) * static_cast<std::size_t>(columns_));
+    }
+
+    /// \returns A reference to the element at the given row and column.
+    /// \requires `row < rows()` and `column < columns()`.
+    reference_type operator()(index_t row, index_t column) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(static_cast<size_t&>(row) < rows_
+                                && static_cast<size_t&>(column) < columns_,
+                                detail::precondition_error_handler{}, "out of bounds matrix access");
+        return data_[index_of(row, column)];
+    }
+
+    /// \returns An [ts::array_ref]() viewing the given row.
+    /// \requires `row < rows()`.
+    array_ref<T> row(index_t row) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(static_cast<size_t&>(row) < rows_,
+                                detail::precondition_error_handler{},
+                                "out of bounds matrix access");
+        return array_ref<T>(data_
+                                + static_cast<std::size_t>(static_cast<size_t&>(row))
+                                      * static_cast<std::size_t>(row_stride_),
+                            columns_);
+    }
+
+    /// \returns An `array_ref_2d` viewing the block of `rows` by `columns` elements
+    /// whose top left corner is at the given position, sharing the stride.
+    /// \requires The block must be inside the matrix.
+    array_ref_2d block(index_t row, index_t column, size_t rows, size_t columns) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(static_cast<size_t&>(row) + rows <= rows_
+                                && static_cast<size_t&>(column) + columns <= columns_,
+                                detail::precondition_error_handler{}, "block outside the matrix");
+        return array_ref_2d(data_ + index_of(row, column), rows, columns, row_stride_);
+    }
+
+    /// \effects Invokes `f` once for every tile of (at most) `TileRows` by `TileCols` elements,
+    /// passing it the tile as an `array_ref_2d` and the position of its top left corner.
+    /// Tiles are visited row major and together cover every element exactly once;
+    /// tiles at the right and bottom edges may be smaller.
+    ///
+    /// Traversing tile by tile keeps the working set of a kernel inside the cache,
+    /// e.g. a transpose touches `TileCols` cache lines per tile instead of one per element.
+    template <std::size_t TileRows, std::size_t TileCols, typename Func>
+    void for_each_tile(Func f) const
+    {
+        static_assert(TileRows > 0u && TileCols > 0u, "tiles must not be empty");
+
+        auto rows    = static_cast<std::size_t>(rows_);
+        auto columns = static_cast<std::size_t>(columns_);
+        for (std::size_t row = 0u; row < rows; row += TileRows)
+        {
+            auto tile_rows = rows - row < TileRows ? rows - row : TileRows;
+            for (std::size_t column = 0u; column < columns; column += TileCols)
+            {
+                auto tile_columns = columns - column < TileCols ? columns - column : TileCols;
+                f(block(index_t(row), index_t(column), size_t(tile_rows), size_t(tile_columns)),
+                  index_t(row), index_t(column));
+            }
+        }
+    }
+
+    /// \effects Prefetches the beginning of the row `lookahead` rows after `row`,
+    /// so its cache lines are in flight while the current row is processed.
+    /// A target outside the matrix is ignored,
+    /// making the call safe in the first and last iterations of a loop.
+    /// \notes This is a performance hint only, it never changes observable behavior.
+    void prefetch(index_t row, difference_t lookahead) const noexcept
+    {
+        auto target = static_cast<std::ptrdiff_t>(make_signed(static_cast<size_t&>(row)))
+                      + static_cast<std::ptrdiff_t>(static_cast<ptrdiff_t&>(lookahead));
+        if (target >= 0 && target < static_cast<std::ptrdiff_t>(static_cast<std::size_t>(rows_)))
+            TYPE_SAFE_PREFETCH(data_
+                               + static_cast<std::size_t>(target)
+                                     * static_cast<std::size_t>(row_stride_));
+    }
+
+private:
+    std::size_t index_of(index_t row, index_t column) const noexcept
+    {
+        return static_cast<std::size_t>(static_cast<size_t&>(row))
+                   * static_cast<std::size_t>(row_stride_)
+               + static_cast<std::size_t>(static_cast<size_t&>(column));
+    }
+
+    T*     data_;
+    size_t rows_;
+    size_t columns_;
+    size_t row_stride_;
+};
+
+/// Creates an [ts::array_ref_2d]().
+/// \returns The reference created by forwarding the parameter(s) to the constructor.
+/// \group array_ref_2d_ref
+template <typename T>
+array_ref_2d<T> ref(T* data, size_t rows, size_t columns) noexcept
+{
+    return array_ref_2d<T>(data, rows, columns);
+}
+
+/// \group array_ref_2d_ref
+template <typename T>
+array_ref_2d<T> ref(T* data, size_t rows, size_t columns, size_t row_stride) noexcept
+{
+    return array_ref_2d<T>(data, rows, columns, row_stride);
+}
+
+/// Creates an [ts::array_ref_2d]() to `const`.
+/// \returns The reference created by forwarding the parameter(s) to the constructor.
+/// \group array_ref_2d_cref
+template <typename T>
+array_ref_2d<const T> cref(const T* data, size_t rows, size_t columns) noexcept
+{
+    return array_ref_2d<const T>(data, rows, columns);
+}
+
+/// \group array_ref_2d_cref
+template <typename T>
+array_ref_2d<const T> cref(const T* data, size_t rows, size_t columns,
+                           size_t row_stride) noexcept
+{
+    return array_ref_2d<const T>(data, rows, columns, row_stride);
+}
+
+/// An [ts::array_ref]() whose internal pointer is `restrict` qualified.
+///
+/// By creating one the caller promises that for its entire lifetime
+/// no element of the array is accessed through anything but this reference,
+/// so a kernel taking e.g. an input and an output array is vectorized
+/// the same way as a hand written `T* restrict` signature.
+/// That promise is the caller's responsibility and cannot be checked;
+/// violating it is undefined behavior.
+/// \notes Like [ts::no_alias_ref]() it is deliberately minimal,
+/// reassignment and the richer views stay on [ts::array_ref]().
+/// \notes A top-level `restrict` on a return type is discarded,
+/// so a kernel that iterates through raw pointers should hoist them into locals,
+/// `T* TYPE_SAFE_RESTRICT p = ref.data();`,
+/// to re-state the promise to the optimizer.
+template <typename T>
+class no_alias_array_ref
+{
+    static_assert(!std::is_void<T>::value, "must not be void");
+    static_assert(!std::is_reference<T>::value, "pass the type without reference");
+
+public:
+    using value_type     = T;
+    using reference_type = T&;
+    using iterator       = T*;
+
+    /// \effects Sets the reference to the memory range `[array, array + size)`.
+    /// \requires `array` must not be `nullptr` unless `size` is `0`.
+    /// \group ptr_size
+    no_alias_array_ref(T* array, size_t size) noexcept : begin_(array), size_(size)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(size == 0u || array, detail::precondition_error_handler{},
+                                "invalid array bounds");
+    }
+
+    /// \effects Sets the reference to the C array.
+    /// \group c_array
+    template <std::size_t Size>
+    explicit no_alias_array_ref(T (&arr)[Size]) : begin_(arr), size_(Size)
+    {}
+
+    /// \returns An iterator to the beginning of the array.
+    iterator begin() const noexcept
+    {
+        return begin_;
+    }
+
+    /// \returns An iterator one past the last element of the array.
+    iterator end() const noexcept
+    {
+        return begin_ + static_cast<std::size_t>(size_);
+    }
+
+    /// \returns A pointer to the beginning of the array.
+    T* data() const noexcept
+    {
+        return begin_;
+    }
+
+    /// \returns The number of elements in the array.
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// \returns A reference to the `i`th element of the array.
+    /// \requires `i < size()`.
+    reference_type operator[](index_t i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(static_cast<size_t&>(i) < size_,
+                                detail::precondition_error_handler{},
+                                "out of bounds array access");
+        return begin_[static_cast<std::size_t>(static_cast<size_t&>(i))];
+    }
+
+    /// \returns A plain [ts::array_ref]() to the same array, dropping the promise.
+    operator array_ref<T>() const noexcept
+    {
+        return array_ref<T>(begin_, size_);
+    }
+
+private:
+    T* TYPE_SAFE_RESTRICT begin_;
+    size_t                size_;
+};
+
+/// Creates a [ts::no_alias_array_ref]().
+/// \returns The reference created by forwarding the parameter(s) to the constructor.
+/// \group no_alias_array_ref_ref
+template <typename T, std::size_t Size>
+no_alias_array_ref<T> ref_no_alias(T (&arr)[Size]) noexcept
+{
+    return no_alias_array_ref<T>(arr);
+}
+
+/// \group no_alias_array_ref_ref
+template <typename T>
+no_alias_array_ref<T> ref_no_alias(T* array, size_t size) noexcept
+{
+    return no_alias_array_ref<T>(array, size);
+}
+
+/// Creates a [ts::no_alias_array_ref]() to `const`.
+/// \returns The reference created by forwarding the parameter(s) to the constructor.
+/// \group no_alias_array_ref_cref
+template <typename T, std::size_t Size>
+no_alias_array_ref<const T> cref_no_alias(const T (&arr)[Size]) noexcept
+{
+    return no_alias_array_ref<const T>(arr);
+}
+
+/// \group no_alias_array_ref_cref
+template <typename T>
+no_alias_array_ref<const T> cref_no_alias(const T* array, size_t size) noexcept
+{
+    return no_alias_array_ref<const T>(array, size);
+}
+
 /// \exclude
 namespace detail
 {
@@ -555,6 +1033,10 @@ namespace detail
 /// But if it is created with a function pointer or something convertible to a function pointer,
 /// it will store the function pointer itself.
 /// This allows creating it from stateless lambdas.
+/// If the function pointer matches the signature exactly,
+/// it is stored bare and invoked directly,
+/// instead of going through the usual callback that loads the target from the storage —
+/// one indirect call instead of two for the common captureless case.
 /// \notes Due to implementation reasons,
 /// it does not support member function pointers,
 /// as it requires regular function call syntax.
@@ -665,8 +1147,16 @@ public:
     }
 
     /// \effects Invokes the stored function with the specified arguments and returns the result.
+    /// \notes If the reference was created from a function pointer matching the signature exactly,
+    /// this is a single indirect call.
     Return operator()(Args... args) const
     {
+        if (cb_ == nullptr)
+        {
+            // storage contains a bare function pointer of the exact signature
+            auto func = *static_cast<const direct_callback*>(storage_.get());
+            return static_cast<Return>(func(static_cast<Args>(args)...));
+        }
         return cb_(storage_.get(), static_cast<Args>(args)...);
     }
 
@@ -694,15 +1184,25 @@ private:
         using pointer_type        = Return2 (*)(Args2...);
         using stored_pointer_type = void (*)();
 
-        DEBUG_ASSERT(fptr, detail::precondition_error_handler{},
-                     "function pointer must not be null");
+        TYPE_SAFE_DETAIL_ASSERT(fptr, detail::precondition_error_handler{},
+                                "function pointer must not be null");
         ::new (storage_.get()) stored_pointer_type(reinterpret_cast<stored_pointer_type>(fptr));
 
         cb_ = &invoke_function_pointer<pointer_type, stored_pointer_type>;
     }
 
-    using storage  = detail::aligned_union<void*, Return (*)(Args...)>;
-    using callback = Return (*)(const void*, Args...);
+    // fast path: a pointer matching the signature exactly can be called as-is,
+    // so it is stored bare with a null callback as the discriminant
+    function_ref(detail::matching_function_pointer_tag, Return (*fptr)(Args...)) : cb_(nullptr)
+    {
+        TYPE_SAFE_DETAIL_ASSERT(fptr, detail::precondition_error_handler{},
+                                "function pointer must not be null");
+        ::new (storage_.get()) direct_callback(fptr);
+    }
+
+    using storage         = detail::aligned_union<void*, Return (*)(Args...)>;
+    using callback        = Return (*)(const void*, Args...);
+    using direct_callback = Return (*)(Args...);
 
     storage  storage_;
     callback cb_;
@@ -0,0 +1,222 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_SOA_VECTOR_HPP_INCLUDED
+#define TYPE_SAFE_SOA_VECTOR_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <cstddef>
+#    include <tuple>
+#    include <vector>
+#endif
+
+#include <type_safe/detail/assert.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+namespace type_safe
+{
+/// \exclude
+namespace detail
+{
+    template <typename T, typename... Ts>
+    struct soa_column_index;
+
+    template <typename T, typename... Ts>
+    struct soa_column_index<T, T, Ts...> : std::integral_constant<std::size_t, 0u>
+    {};
+
+    template <typename T, typename U, typename... Ts>
+    struct soa_column_index<T, U, Ts...>
+    : std::integral_constant<std::size_t, 1u + soa_column_index<T, Ts...>::value>
+    {};
+} // namespace detail
+
+/// A vector of records in structure of arrays layout.
+///
+/// Each record consists of one field per [ts::strong_typedef]() in `StrongTypedefs...`
+/// and every field is stored in its own contiguous column of the underlying type.
+/// A kernel that touches a single field thus streams over one dense array
+/// instead of striding through whole records,
+/// while field access stays typed through the strong typedefs:
+/// records are accessed through a proxy whose `get<Field>()` returns `Field&`,
+/// and whole columns through [ts::array_ref]() views of either the field or the underlying type.
+/// \requires Every type must be a distinct [ts::strong_typedef]()
+/// with the layout of its underlying type,
+/// as verified by [ts::underlying_array_ref]().
+template <class... StrongTypedefs>
+class soa_vector
+{
+    template <class Field>
+    using column_index = detail::soa_column_index<Field, StrongTypedefs...>;
+
+    template <class Field>
+    using column_value_type = typename detail::verify_underlying_layout<Field>::type;
+
+public:
+    using size_type = std::size_t;
+
+    /// A proxy for a single record.
+    ///
+    /// It is a lightweight view, copying it does not copy the fields.
+    /// \group record_proxy
+    class reference
+    {
+    public:
+        /// \returns A reference to the given field of the record,
+        /// typed as the strong typedef.
+        template <class Field>
+        Field& get() const noexcept
+        {
+            return vec_->template column<Field>()[index_];
+        }
+
+    private:
+        reference(soa_vector* vec, size_type index) noexcept : vec_(vec), index_(index) {}
+
+        soa_vector* vec_;
+        size_type   index_;
+
+        friend soa_vector;
+    };
+
+    /// \group record_proxy
+    class const_reference
+    {
+    public:
+        /// \returns A `const` reference to the given field of the record.
+        template <class Field>
+        const Field& get() const noexcept
+        {
+            return vec_->template column<Field>()[index_];
+        }
+
+    private:
+        const_reference(const soa_vector* vec, size_type index) noexcept
+        : vec_(vec), index_(index)
+        {}
+
+        const soa_vector* vec_;
+        size_type         index_;
+
+        friend soa_vector;
+    };
+
+    //=== constructors ===//
+    /// \effects Creates it without any records.
+    soa_vector() = default;
+
+    //=== capacity ===//
+    /// \returns Whether or not there are any records.
+    bool empty() const noexcept
+    {
+        return std::get<0>(columns_).empty();
+    }
+
+    /// \returns The number of records.
+    size_type size() const noexcept
+    {
+        return std::get<0>(columns_).size();
+    }
+
+    /// \effects Reserves storage for `n` records in every column.
+    void reserve(size_type n)
+    {
+        // the array sequences one call per column
+        bool expand[] = {(std::get<column_index<StrongTypedefs>::value>(columns_).reserve(n),
+                          true)...};
+        (void)expand;
+    }
+
+    /// \effects Destroys all records without releasing the storage.
+    void clear() noexcept
+    {
+        bool expand[] = {(std::get<column_index<StrongTypedefs>::value>(columns_).clear(),
+                          true)...};
+        (void)expand;
+    }
+
+    //=== modifiers ===//
+    /// \effects Appends a record consisting of the given fields, one per column.
+    void push_back(const StrongTypedefs&... fields)
+    {
+        bool expand[] = {(std::get<column_index<StrongTypedefs>::value>(columns_).push_back(
+                              static_cast<const column_value_type<StrongTypedefs>&>(fields)),
+                          true)...};
+        (void)expand;
+    }
+
+    /// \effects Removes the last record.
+    /// \requires `empty() == false`.
+    void pop_back() noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(!empty(), detail::precondition_error_handler{});
+        bool expand[] = {(std::get<column_index<StrongTypedefs>::value>(columns_).pop_back(),
+                          true)...};
+        (void)expand;
+    }
+
+    //=== access ===//
+    /// \returns A proxy for the record at index `i`.
+    /// \requires `i < size()`.
+    /// \group subscript
+    reference operator[](size_type i) noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{},
+                                "index out of bounds");
+        return reference(this, i);
+    }
+
+    /// \group subscript
+    const_reference operator[](size_type i) const noexcept
+    {
+        TYPE_SAFE_DETAIL_ASSERT(i < size(), detail::precondition_error_handler{},
+                                "index out of bounds");
+        return const_reference(this, i);
+    }
+
+    /// \returns An [ts::array_ref]() viewing the entire column of the given field,
+    /// typed as the strong typedef.
+    /// \group column
+    template <class Field>
+    array_ref<Field> column() noexcept
+    {
+        auto& vec = std::get<column_index<Field>::value>(columns_);
+        return strong_array_ref<Field>(vec.data(), vec.size());
+    }
+
+    /// \group column
+    template <class Field>
+    array_ref<const Field> column() const noexcept
+    {
+        auto& vec = std::get<column_index<Field>::value>(columns_);
+        return strong_array_ref<Field>(vec.data(), vec.size());
+    }
+
+    /// \returns An [ts::array_ref]() viewing the entire column of the given field
+    /// as the underlying type, for kernels operating on the raw values.
+    /// \group underlying_column
+    template <class Field>
+    array_ref<column_value_type<Field>> underlying_column() noexcept
+    {
+        auto& vec = std::get<column_index<Field>::value>(columns_);
+        return array_ref<column_value_type<Field>>(vec.data(), vec.size());
+    }
+
+    /// \group underlying_column
+    template <class Field>
+    array_ref<const column_value_type<Field>> underlying_column() const noexcept
+    {
+        auto& vec = std::get<column_index<Field>::value>(columns_);
+        return array_ref<const column_value_type<Field>>(vec.data(), vec.size());
+    }
+
+private:
+    std::tuple<std::vector<column_value_type<StrongTypedefs>>...> columns_;
+};
+} // namespace type_safe
+
+#endif // TYPE_SAFE_SOA_VECTOR_HPP_INCLUDED
@@ -8,14 +8,21 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <cstdint>
 #include <iosfwd>
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#if defined(__cpp_impl_three_way_comparison) && defined(__has_include)
+#    if __has_include(<compare>)
+#        include <compare>
+#    endif
+#endif
 #endif
 
 #include <type_safe/config.hpp>
 #include <type_safe/detail/all_of.hpp>
+#include <type_safe/detail/force_inline.hpp>
 
 #ifdef _MSC_VER
 #    define TYPE_SAFE_MSC_EMPTY_BASES __declspec(empty_bases)
@@ -51,6 +58,13 @@ namespace type_safe
 ///     using strong_typedef::strong_typedef;
 /// };
 /// ```
+/// \notes The strong typedef is guaranteed to have the same layout as the underlying type:
+/// it is standard layout if `T` is, `sizeof` and `alignof` match `T`,
+/// and it is trivially copyable and trivially destructible whenever `T` is.
+/// This also holds for types derived from it as in the example above,
+/// as all the operation mix-ins from `strong_typedef_op` are empty.
+/// An array of such typedefs can therefore be viewed as an array of the underlying type
+/// without copying, see [ts::underlying_array_ref]().
 template <class Tag, typename T>
 class strong_typedef
 {
@@ -468,6 +482,27 @@ namespace strong_typedef_op
     TYPE_SAFE_DETAIL_MAKE_OP_MIXED(>, mixed_relational_comparison, bool)
     TYPE_SAFE_DETAIL_MAKE_OP_MIXED(>=, mixed_relational_comparison, bool)
 
+#if TYPE_SAFE_USE_THREE_WAY_COMPARISON
+    /// Generates `operator<=>` forwarding to the underlying type.
+    ///
+    /// A single comparison call yields the entire ordering,
+    /// as required by flat/open addressing containers and `std::ranges` algorithms.
+    /// Note that `operator<=>` does not imply `==`/`!=`,
+    /// combine it with [ts::strong_typedef_op::equality_comparison]().
+    template <class StrongTypedef>
+    struct TYPE_SAFE_MSC_EMPTY_BASES three_way_comparison
+    {
+        /// \exclude
+        friend constexpr auto operator<=>(const StrongTypedef& lhs, const StrongTypedef& rhs)
+            noexcept(noexcept(detail::get_underlying<StrongTypedef>(lhs)
+                              <=> detail::get_underlying<StrongTypedef>(rhs)))
+        {
+            return detail::get_underlying<StrongTypedef>(lhs)
+                   <=> detail::get_underlying<StrongTypedef>(rhs);
+        }
+    };
+#endif
+
     TYPE_SAFE_DETAIL_MAKE_STRONG_TYPEDEF_OP(addition, +)
     TYPE_SAFE_DETAIL_MAKE_STRONG_TYPEDEF_OP(subtraction, -)
     TYPE_SAFE_DETAIL_MAKE_STRONG_TYPEDEF_OP(multiplication, *)
@@ -799,6 +834,45 @@ struct TYPE_SAFE_MSC_EMPTY_BASES hashable : std::hash<type_safe::underlying_type
         return underlying_hash{}(static_cast<const underlying_type&>(lhs));
     }
 };
+
+/// \exclude
+namespace detail
+{
+    // the finalizer of splitmix64:
+    // two xor-shift-multiply rounds avalanche every input bit over the entire word
+    TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 std::uint64_t hash_mix(std::uint64_t value) noexcept
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+} // namespace detail
+
+/// Inherit from it in the `std::hash<StrongTypedef>` specialization instead of [ts::hashable]()
+/// to hash the underlying integer through a multiplicative bit mixer.
+///
+/// `std::hash` for integers is commonly the identity function,
+/// which clusters sequential ids into neighbouring buckets of an open addressing hash table.
+/// The mixer gives a uniform probe distribution for dense id ranges,
+/// costs only a few multiply/shift instructions and is usable in constant expressions.
+/// \requires The underlying type must be an integral type.
+template <class StrongTypedef>
+struct TYPE_SAFE_MSC_EMPTY_BASES fast_hashable
+{
+    using underlying_type = type_safe::underlying_type<StrongTypedef>;
+    static_assert(std::is_integral<underlying_type>::value,
+                  "fast_hashable requires an integral underlying type");
+
+    TYPE_SAFE_FORCE_INLINE TYPE_SAFE_CONSTEXPR14 std::size_t operator()(
+        const StrongTypedef& lhs) const noexcept
+    {
+        return static_cast<std::size_t>(detail::hash_mix(
+            static_cast<std::uint64_t>(static_cast<const underlying_type&>(lhs))));
+    }
+};
 } // namespace type_safe
 
 #undef TYPE_SAFE_MSC_EMPTY_BASES
@@ -8,6 +8,7 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#    include <cstdint>
 #    include <new>
 #endif
 
@@ -60,6 +61,51 @@ namespace detail
     struct copy_union;
     template <class Union>
     struct move_union;
+
+#if defined(__GNUC__) && __GNUC__ < 5
+    // does not have is_trivially_copyable
+    template <typename... Types>
+    using is_trivial_union = all_of<std::is_trivial<Types>::value...>;
+#else
+    template <typename... Types>
+    using is_trivial_union = all_of<std::is_trivially_copyable<Types>::value...>;
+#endif
+
+    // controls the copy/move operations of the union
+    // unique per union, so the empty base does not collide
+    // with the generic control bases used by the variant
+    template <bool Trivial, typename... Types>
+    struct union_copy_control
+    {
+        union_copy_control() noexcept = default;
+
+        union_copy_control(const union_copy_control&) noexcept            = default;
+        union_copy_control& operator=(const union_copy_control&) noexcept = default;
+
+        union_copy_control(union_copy_control&&) noexcept            = default;
+        union_copy_control& operator=(union_copy_control&&) noexcept = default;
+    };
+
+    template <typename... Types>
+    struct union_copy_control<false, Types...>
+    {
+        union_copy_control() noexcept = default;
+
+        union_copy_control(const union_copy_control&) noexcept            = delete;
+        union_copy_control& operator=(const union_copy_control&) noexcept = delete;
+
+        union_copy_control(union_copy_control&&) noexcept            = delete;
+        union_copy_control& operator=(union_copy_control&&) noexcept = delete;
+    };
+
+    // the smallest unsigned integer able to store the ids of the given number of types
+    template <std::size_t Count>
+    using compact_type_id = typename std::conditional<
+        (Count <= 0xFFu), std::uint8_t,
+        typename std::conditional<
+            (Count <= 0xFFFFu), std::uint16_t,
+            typename std::conditional<(Count <= 0xFFFFFFFFu), std::uint32_t,
+                                      std::size_t>::type>::type>::type;
 } // namespace detail
 
 /// Tag type so no explicit template instantiation of function parameters is required.
@@ -82,17 +128,15 @@ struct union_types
 /// but remembers which type it currently stores.
 /// It can either store one of the given types or no type at all.
 /// \notes Like the C `union` it does not automatically destroy the currently stored type,
-/// and copy operations are deleted.
+/// and copy operations are deleted,
+/// unless all types are trivially copyable,
+/// in which case the defaulted copy operations simply copy the bytes.
 /// \module variant
 template <typename... Types>
 class tagged_union
+: detail::union_copy_control<detail::is_trivial_union<Types...>::value, Types...>
 {
-#if defined(__GNUC__) && __GNUC__ < 5
-    // does not have is_trivially_copyable
-    using trivial = detail::all_of<std::is_trivial<Types>::value...>;
-#else
-    using trivial = detail::all_of<std::is_trivially_copyable<Types>::value...>;
-#endif
+    using trivial = detail::is_trivial_union<Types...>;
 
     template <class Union>
     friend struct detail::destroy_union;
@@ -142,6 +186,8 @@ public:
     private:
         explicit constexpr type_id(std::size_t value) : strong_typedef<type_id, std::size_t>(value)
         {}
+
+        friend tagged_union;
     };
 
     /// A global invalid type id object.
@@ -153,9 +199,6 @@ public:
     /// \notes Does not destroy the currently stored type.
     ~tagged_union() noexcept = default;
 
-    tagged_union(const tagged_union&)            = delete;
-    tagged_union& operator=(const tagged_union&) = delete;
-
     //=== modifiers ===//
     /// \effects Creates a new object of given type by perfectly forwarding `args`.
     /// \throws Anything thrown by `T`s constructor,
@@ -172,7 +215,7 @@ public:
                       "T not constructible from arguments");
 
         ::new (storage_.get()) T(std::forward<Args>(args)...);
-        cur_type_ = index;
+        cur_type_ = compact_id(get(index));
     }
 
     /// \effects Destroys the currently stored type by calling its destructor,
@@ -183,15 +226,17 @@ public:
     {
         check(type);
         value(type).~T();
-        cur_type_ = invalid_type;
+        cur_type_ = compact_id(0);
     }
 
     //=== accessors ===//
     /// \returns The [*type_id]() of the type currently stored,
     /// or [*invalid_type]() if there is none.
-    const type_id& type() const noexcept
+    /// \notes Only the smallest unsigned integer able to index the types is stored,
+    /// the id is widened on access.
+    type_id type() const noexcept
     {
-        return cur_type_;
+        return type_id(std::size_t(cur_type_));
     }
 
     /// \returns `true` if there is a type stored,
@@ -241,13 +286,15 @@ private:
     template <typename T>
     void check(union_type<T> type) const noexcept
     {
-        DEBUG_ASSERT(cur_type_ == type, detail::precondition_error_handler{},
-                     "different type stored in union");
+        TYPE_SAFE_DETAIL_ASSERT(this->type() == type, detail::precondition_error_handler{},
+                                "different type stored in union");
     }
 
-    using storage_t = detail::aligned_union<Types...>;
-    storage_t storage_;
-    type_id   cur_type_;
+    using storage_t  = detail::aligned_union<Types...>;
+    using compact_id = detail::compact_type_id<sizeof...(Types)>;
+
+    storage_t  storage_;
+    compact_id cur_type_ = compact_id(0);
 };
 
 /// \exclude
@@ -263,11 +310,15 @@ namespace detail
     template <typename Func, class Union, typename... Types, typename... Args>
     class with_union<Func, Union, union_types<Types...>, Args...>
     {
+        using callback = void (*)(Union&&, Func&&, Args&&...);
+
     public:
         static void with(Union&& u, Func&& func, Args&&... args)
         {
-            with_impl(typename std::decay<Union>::type::types{}, std::forward<Union>(u),
-                      std::forward<Func>(func), std::forward<Args>(args)...);
+            // flat dispatch table indexed by the type id, entry 0 is the empty state
+            static constexpr callback table[] = {&with_empty, &with_type<Types>...};
+            table[get(u.type())](std::forward<Union>(u), std::forward<Func>(func),
+                                 std::forward<Args>(args)...);
         }
 
     private:
@@ -284,17 +335,13 @@ namespace detail
         static void call(short, Union&&, Func&&, Args&&...)
         {}
 
-        static void with_impl(union_types<>, Union&&, Func&&, Args&&...) {}
+        static void with_empty(Union&&, Func&&, Args&&...) {}
 
-        template <typename Head, typename... Tail>
-        static void with_impl(union_types<Head, Tail...>, Union&& u, Func&& func, Args&&... args)
+        template <typename T>
+        static void with_type(Union&& u, Func&& func, Args&&... args)
         {
-            if (u.type() == union_type<Head>{})
-                call<Head>(0, std::forward<Union>(u), std::forward<Func>(func),
-                           std::forward<Args>(args)...);
-            else
-                with_impl(union_types<Tail...>{}, std::forward<Union>(u), std::forward<Func>(func),
-                          std::forward<Args>(args)...);
+            call<T>(0, std::forward<Union>(u), std::forward<Func>(func),
+                    std::forward<Args>(args)...);
         }
     };
 } // namespace detail
@@ -358,7 +405,7 @@ namespace detail
         static void destroy(Union& u) noexcept
         {
             if (Union::trivial::value)
-                u.cur_type_ = Union::invalid_type;
+                u.cur_type_ = decltype(u.cur_type_)(0);
             else
                 with(u, visitor{}, u);
         }
@@ -435,7 +482,7 @@ void destroy(tagged_union<Types...>& u) noexcept
 template <typename... Types>
 void copy(tagged_union<Types...>& dest, const tagged_union<Types...>& org)
 {
-    DEBUG_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
+    TYPE_SAFE_DETAIL_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
     detail::copy_union<tagged_union<Types...>>::copy(dest, org);
 }
 
@@ -445,7 +492,7 @@ void copy(tagged_union<Types...>& dest, const tagged_union<Types...>& org)
 template <typename... Types>
 void move(tagged_union<Types...>& dest, tagged_union<Types...>&& org)
 {
-    DEBUG_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
+    TYPE_SAFE_DETAIL_ASSERT(!dest.has_value(), detail::precondition_error_handler{});
     detail::move_union<tagged_union<Types...>>::move(dest, std::move(org));
 }
 } // namespace type_safe
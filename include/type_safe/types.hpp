@@ -48,6 +48,25 @@ namespace detail
     {
         return validate_value<T, unsigned long long, parse<unsigned long long, Digits...>()>();
     }
+
+    template <std::size_t Bits, bool Signed>
+    struct pick_integer
+    {
+        static_assert(Bits <= 64u, "no standard integer type has that many bits");
+
+        using type = typename std::conditional<
+            Bits <= 8u,
+            typename std::conditional<Signed, std::int_least8_t, std::uint_least8_t>::type,
+            typename std::conditional<
+                Bits <= 16u,
+                typename std::conditional<Signed, std::int_least16_t, std::uint_least16_t>::type,
+                typename std::conditional<
+                    Bits <= 32u,
+                    typename std::conditional<Signed, std::int_least32_t,
+                                              std::uint_least32_t>::type,
+                    typename std::conditional<Signed, std::int_least64_t,
+                                              std::uint_least64_t>::type>::type>::type>::type;
+    };
 } // namespace detail
 
 #if TYPE_SAFE_ENABLE_WRAPPER
@@ -170,6 +189,20 @@ inline namespace types
     /// \module types
     using uint_least64_t = TYPE_SAFE_DETAIL_WRAP(integer, std::uint_least64_t);
 
+#if TYPE_SAFE_ENABLE_WRAPPER
+    /// An alias for the smallest wrapped integer type with at least `Bits` bits,
+    /// signed if `Signed` is `true`.
+    ///
+    /// It selects among the `_least` family,
+    /// so packed structs get the tightest width without hand-auditing the typedefs.
+    /// \module types
+    template <std::size_t Bits, bool Signed = true>
+    using pick_integer = integer<typename detail::pick_integer<Bits, Signed>::type>;
+#else
+    template <std::size_t Bits, bool Signed = true>
+    using pick_integer = typename detail::pick_integer<Bits, Signed>::type;
+#endif
+
     /// \module types
     using intmax_t = TYPE_SAFE_DETAIL_WRAP(integer, std::intmax_t);
     /// \module types
@@ -131,14 +131,16 @@ public:
     /// \group ctor_union
     explicit basic_variant(const tagged_union<HeadT, TailT...>& u)
     {
-        DEBUG_ASSERT(allow_empty::value || u.has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(allow_empty::value || u.has_value(),
+                                detail::precondition_error_handler{});
         copy(storage_.get_union(), u);
     }
 
     /// \group ctor_union
     explicit basic_variant(tagged_union<HeadT, TailT...>&& u)
     {
-        DEBUG_ASSERT(allow_empty::value || u.has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(allow_empty::value || u.has_value(),
+                                detail::precondition_error_handler{});
         move(storage_.get_union(), std::move(u));
     }
 
@@ -341,7 +343,7 @@ public:
     /// \requires The variant must be empty.
     nullvar_t value(variant_type<nullvar_t>) const noexcept
     {
-        DEBUG_ASSERT(!has_value(), detail::precondition_error_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(!has_value(), detail::precondition_error_handler{});
         return nullvar;
     }
 
@@ -486,7 +488,7 @@ public:
         detail::map_union<Functor&&, union_t>::map(result.storage_.get_union(),
                                                    storage_.get_union(), std::forward<Functor>(f),
                                                    std::forward<Args>(args)...);
-        DEBUG_ASSERT(result.has_value(), detail::assert_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(result.has_value(), detail::assert_handler{});
         return result;
     }
 
@@ -507,7 +509,7 @@ public:
                                                    std::move(storage_.get_union()),
                                                    std::forward<Functor>(f),
                                                    std::forward<Args>(args)...);
-        DEBUG_ASSERT(result.has_value(), detail::assert_handler{});
+        TYPE_SAFE_DETAIL_ASSERT(result.has_value(), detail::assert_handler{});
         return result;
     }
 #endif
@@ -901,6 +903,59 @@ using rarely_empty_variant_policy = detail::non_empty_variant_policy<false>;
 /// \module variant
 using never_empty_variant_policy = detail::non_empty_variant_policy<true>;
 
+/// A variant policy for [ts::basic_variant]() where all types are trivially copyable.
+///
+/// As no destructor ever needs to run, changing the type does not need a
+/// destroy/construct call pair: the new value is constructed directly over the old bytes
+/// followed by the tag store.
+/// If constructing the new value from the arguments can throw,
+/// it is constructed on the stack first, so the variant is never left empty.
+/// \requires All types stored in the variant must be trivially copyable.
+/// \module variant
+class relocating_variant_policy
+{
+public:
+    using allow_empty = std::false_type;
+
+    template <typename T, typename... Types, typename... Args>
+    static void change_value(union_type<T> type, tagged_union<Types...>& storage, Args&&... args)
+    {
+        static_assert(detail::is_trivial_union<Types...>::value,
+                      "all types must be trivially copyable");
+        change_value_impl(type, storage, std::forward<Args>(args)...);
+    }
+
+private:
+    template <typename T, typename... Types, typename... Args>
+    static auto change_value_impl(union_type<T> type, tagged_union<Types...>& storage,
+                                  Args&&... args) noexcept ->
+        typename std::enable_if<std::is_nothrow_constructible<T, Args&&...>::value>::type
+    {
+        // nothing to destroy, overwrite the old bytes and store the new tag
+        destroy(storage);
+        storage.emplace(type, std::forward<Args>(args)...);
+    }
+
+    template <typename T, typename... Types, typename... Args>
+    static auto change_value_impl(union_type<T> type, tagged_union<Types...>& storage,
+                                  Args&&... args) ->
+        typename std::enable_if<!std::is_nothrow_constructible<T, Args&&...>::value>::type
+    {
+        T tmp(std::forward<Args>(args)...); // might throw
+        destroy(storage);
+        // copying the temporary is trivial, won't throw
+        storage.emplace(type, tmp);
+    }
+};
+
+/// A [ts::basic_variant]() using the [ts::relocating_variant_policy]().
+///
+/// This is a variant for trivially copyable types that is never empty,
+/// where changing the type is a plain copy of the bytes plus a tag store.
+/// \module variant
+template <typename... Types>
+using relocating_variant = basic_variant<relocating_variant_policy, Types...>;
+
 /// \exclude
 namespace detail
 {
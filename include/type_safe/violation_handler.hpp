@@ -0,0 +1,201 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#ifndef TYPE_SAFE_VIOLATION_HANDLER_HPP_INCLUDED
+#define TYPE_SAFE_VIOLATION_HANDLER_HPP_INCLUDED
+
+#if defined(TYPE_SAFE_IMPORT_STD_MODULE)
+import std;
+#else
+#    include <atomic>
+#    include <cstring>
+#    include <mutex>
+#endif
+
+#include <debug_assert.hpp>
+
+#include <type_safe/config.hpp>
+
+namespace type_safe
+{
+/// The kind of check that was violated.
+enum class violation_kind
+{
+    assertion,    //< an internal assertion of the library implementation
+    precondition, //< a precondition of a library function
+};
+
+/// Describes a single violated check.
+///
+/// All pointers refer to string literals baked into the binary at the check site,
+/// so the descriptor can be stored or compared without copying.
+struct violation_info
+{
+    /// The kind of check.
+    violation_kind kind;
+    /// The file and line of the check.
+    const char* file_name;
+    unsigned    line_number;
+    /// The stringified expression that evaluated to `false`.
+    const char* expression;
+    /// An optional message describing the check, or `nullptr`.
+    const char* message;
+};
+
+/// The type of a function handling a violated check.
+///
+/// It receives the descriptor of the check
+/// and returns `true` to continue execution or `false` to terminate via `std::abort()`.
+/// It must not throw.
+/// \notes Continuing is only sound for checks that guard semantics, not memory safety;
+/// code reached with `DEBUG_UNREACHABLE` always terminates regardless of the handler.
+using violation_handler = bool (*)(const violation_info& info);
+
+/// \exclude
+namespace detail
+{
+    inline std::atomic<violation_handler>& violation_handler_storage() noexcept
+    {
+        static std::atomic<violation_handler> handler{nullptr};
+        return handler;
+    }
+
+    // The failure path of every check funnels through here.
+    // It is outlined and cold, the check site only pays the predicted-not-taken branch.
+    TYPE_SAFE_COLD inline bool on_violation(violation_kind kind,
+                                            const debug_assert::source_location& loc,
+                                            const char* expression, const char* message)
+    {
+        auto handler = violation_handler_storage().load(std::memory_order_acquire);
+        if (!handler)
+            return false;
+        return handler(violation_info{kind, loc.file_name, loc.line_number, expression, message});
+    }
+} // namespace detail
+
+/// \effects Installs `handler` as the process-wide handler invoked on every violated check,
+/// replacing the previous one.
+/// Passing `nullptr` restores the default behavior,
+/// which writes a message to `stderr` and calls `std::abort()`.
+/// \returns The previously installed handler, `nullptr` for the default.
+/// \notes This function is thread safe,
+/// but checks that are already executing may still see the previous handler.
+inline violation_handler set_violation_handler(violation_handler handler) noexcept
+{
+    return detail::violation_handler_storage().exchange(handler, std::memory_order_acq_rel);
+}
+
+/// \exclude
+namespace detail
+{
+    struct violation_site
+    {
+        const char*                           file_name;
+        unsigned                              line_number;
+        violation_kind                        kind;
+        const char*                           expression;
+        std::atomic<unsigned long long>       count;
+    };
+
+    struct violation_site_table
+    {
+        static const std::size_t capacity = 256;
+
+        violation_site                  sites[capacity];
+        std::atomic<std::size_t>        size;
+        std::atomic<unsigned long long> overflow;
+        std::mutex                      insert_mutex;
+
+        violation_site_table() : sites(), size(0u), overflow(0u) {}
+
+        static bool matches(const violation_site& site, const violation_info& info) noexcept
+        {
+            // same line and same file;
+            // the file name literal is not guaranteed to be merged across translation units,
+            // so fall back to a string comparison on the cold path
+            return site.line_number == info.line_number
+                   && (site.file_name == info.file_name
+                       || std::strcmp(site.file_name, info.file_name) == 0);
+        }
+
+        violation_site* find(const violation_info& info, std::size_t n) noexcept
+        {
+            for (std::size_t i = 0u; i != n; ++i)
+                if (matches(sites[i], info))
+                    return &sites[i];
+            return nullptr;
+        }
+
+        void record(const violation_info& info) noexcept
+        {
+            auto published = size.load(std::memory_order_acquire);
+            auto site      = find(info, published);
+            if (!site)
+            {
+                std::lock_guard<std::mutex> lock(insert_mutex);
+                // another thread may have inserted the site in the meantime
+                site = find(info, size.load(std::memory_order_relaxed));
+                if (!site)
+                {
+                    auto n = size.load(std::memory_order_relaxed);
+                    if (n == capacity)
+                    {
+                        overflow.fetch_add(1u, std::memory_order_relaxed);
+                        return;
+                    }
+                    sites[n].file_name   = info.file_name;
+                    sites[n].line_number = info.line_number;
+                    sites[n].kind        = info.kind;
+                    sites[n].expression  = info.expression;
+                    // publish the entry, all fields except the count are immutable afterwards
+                    size.store(n + 1u, std::memory_order_release);
+                    site = &sites[n];
+                }
+            }
+            site->count.fetch_add(1u, std::memory_order_relaxed);
+        }
+    };
+
+    inline violation_site_table& violation_sites() noexcept
+    {
+        static violation_site_table table;
+        return table;
+    }
+} // namespace detail
+
+/// A built-in [ts::violation_handler]() that counts violations per check site and continues.
+///
+/// Each distinct file/line gets its own counter which is incremented with a relaxed atomic,
+/// so concurrent violations never block each other.
+/// The recorded sites can be read with [ts::for_each_violation]() at any time,
+/// e.g. by a metrics exporter.
+/// \notes The table holds up to 256 distinct sites;
+/// violations at further sites are counted in a single shared overflow counter
+/// and do not show up in the iteration.
+inline bool count_violations(const violation_info& info)
+{
+    detail::violation_sites().record(info);
+    return true;
+}
+
+/// \effects Invokes `f(info, count)` for every check site recorded by [ts::count_violations](),
+/// where `info` is the [ts::violation_info]() of the site with a `nullptr` message
+/// and `count` the number of violations observed there so far.
+/// \notes It is safe to call concurrently with violations being counted;
+/// counts read during iteration may lag behind by in-flight increments.
+template <typename Func>
+void for_each_violation(Func f)
+{
+    auto& table = detail::violation_sites();
+    auto  n     = table.size.load(std::memory_order_acquire);
+    for (std::size_t i = 0u; i != n; ++i)
+    {
+        auto& site = table.sites[i];
+        f(violation_info{site.kind, site.file_name, site.line_number, site.expression, nullptr},
+          site.count.load(std::memory_order_relaxed));
+    }
+}
+} // namespace type_safe
+
+#endif // TYPE_SAFE_VIOLATION_HANDLER_HPP_INCLUDED
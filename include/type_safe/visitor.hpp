@@ -8,7 +8,26 @@
 #if defined(TYPE_SAFE_IMPORT_STD_MODULE)
 import std;
 #else
+#include <iterator>
 #include <utility>
+#include <vector>
+#endif
+
+#ifndef TYPE_SAFE_USE_PARALLEL_VISIT
+/// Controls whether the overloads of [ts::visit]() taking a `std::execution` policy are provided.
+///
+/// It is disabled by default and opt-in:
+/// with libstdc++ `<execution>` pulls in the TBB based PSTL backend,
+/// which every consumer would then have to link.
+/// Define it to `1` to enable the overloads;
+/// this requires `<execution>` in C++17 mode and linking whatever backend
+/// the standard library implementation needs.
+#    define TYPE_SAFE_USE_PARALLEL_VISIT 0
+#endif
+
+#if TYPE_SAFE_USE_PARALLEL_VISIT && !defined(TYPE_SAFE_IMPORT_STD_MODULE)
+#    include <execution>
+#    include <thread>
 #endif
 
 #include <type_safe/optional.hpp>
@@ -126,6 +145,111 @@ namespace detail
         static const bool value = decltype(test<typename std::decay<T>::type>(0))::value;
     };
 
+    //=== visit optional via presence mask ===//
+    template <std::size_t... Is>
+    struct index_seq
+    {};
+
+    template <std::size_t N, std::size_t... Is>
+    struct make_index_seq : make_index_seq<N - 1u, N - 1u, Is...>
+    {};
+
+    template <std::size_t... Is>
+    struct make_index_seq<0u, Is...>
+    {
+        using type = index_seq<Is...>;
+    };
+
+    template <typename Optional>
+    auto masked_value(std::true_type, Optional&& opt) -> decltype(std::forward<Optional>(opt)
+                                                                      .value())
+    {
+        return std::forward<Optional>(opt).value();
+    }
+
+    template <typename Optional>
+    nullopt_t masked_value(std::false_type, Optional&&)
+    {
+        return nullopt;
+    }
+
+    inline std::size_t presence_mask()
+    {
+        return 0u;
+    }
+
+    template <class Optional, class... Rest>
+    std::size_t presence_mask(const Optional& opt, const Rest&... rest)
+    {
+        return (opt.has_value() ? std::size_t(1) : std::size_t(0)) | (presence_mask(rest...) << 1);
+    }
+
+    template <bool Save, typename Visitor, class... Optionals>
+    class visit_masked_impl
+    {
+        template <typename... Args>
+        static auto call_visitor(int, Visitor&& visitor, Args&&... args)
+            -> decltype(std::forward<Visitor>(visitor)(std::forward<Args>(args)...))
+        {
+            return std::forward<Visitor>(visitor)(std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        static void call_visitor(short, Visitor&&, Args&&...)
+        {
+            static_assert(!Save, "call to visitor does not cover all possible combinations");
+        }
+
+        using return_type = decltype(visit_optional<Save, Visitor, Optionals...>::call(
+            std::declval<Visitor>(), std::declval<Optionals>()...));
+        using callback    = return_type (*)(Visitor&&, Optionals&&...);
+
+        template <std::size_t Mask, std::size_t... Is>
+        static return_type call_entry(std::true_type /* void return */, index_seq<Is...>,
+                                      Visitor&& visitor, Optionals&&... opts)
+        {
+            call_visitor(0, std::forward<Visitor>(visitor),
+                         masked_value(std::integral_constant<bool, ((Mask >> Is) & 1u) != 0u>{},
+                                      std::forward<Optionals>(opts))...);
+        }
+
+        template <std::size_t Mask, std::size_t... Is>
+        static return_type call_entry(std::false_type /* non-void return */, index_seq<Is...>,
+                                      Visitor&& visitor, Optionals&&... opts)
+        {
+            return call_visitor(0, std::forward<Visitor>(visitor),
+                                masked_value(std::integral_constant<bool,
+                                                                    ((Mask >> Is) & 1u) != 0u>{},
+                                             std::forward<Optionals>(opts))...);
+        }
+
+        template <std::size_t Mask>
+        static return_type call_masked(Visitor&& visitor, Optionals&&... opts)
+        {
+            return call_entry<Mask>(std::is_void<return_type>{},
+                                    typename make_index_seq<sizeof...(Optionals)>::type{},
+                                    std::forward<Visitor>(visitor), std::forward<Optionals>(opts)...);
+        }
+
+        // flat dispatch table with one entry per combination of present optionals,
+        // indexed by the packed has_value() bits
+        template <std::size_t... Masks>
+        static return_type dispatch(index_seq<Masks...>, Visitor&& visitor, Optionals&&... opts)
+        {
+            static constexpr callback table[] = {&call_masked<Masks>...};
+            return table[presence_mask(opts...)](std::forward<Visitor>(visitor),
+                                                 std::forward<Optionals>(opts)...);
+        }
+
+    public:
+        static return_type call(Visitor&& visitor, Optionals&&... opts)
+        {
+            return dispatch(typename make_index_seq<(
+                                std::size_t(1) << sizeof...(Optionals))>::type{},
+                            std::forward<Visitor>(visitor), std::forward<Optionals>(opts)...);
+        }
+    };
+
     template <typename Visitor, class... Optionals>
     auto visit_optional_impl(Visitor&& visitor, Optionals&&... optionals) -> decltype(
         detail::visit_optional<
@@ -168,6 +292,34 @@ auto visit(Visitor&& visitor, Optionals&&... optionals)
                                        std::forward<Optionals>(optionals)...);
 }
 
+/// Visits [ts::basic_optional]()s through a flat dispatch table.
+/// \effects The same as the optional overload of [ts::visit](),
+/// but instead of expanding to a nested branch per optional,
+/// it packs the `has_value()` bits of all optionals into a mask
+/// and selects the matching combination from a table
+/// with one entry per combination — the same technique the variant visitation uses —
+/// so visiting several optionals is a single indexed call.
+/// \returns The result of the chosen `operator()`,
+/// its type is the common type of all possible combinations.
+/// \module optional
+/// \exclude return
+/// \param 2
+/// \exclude
+template <typename Visitor, class... Optionals,
+          typename std::enable_if<detail::all_of<detail::is_optional<Optionals>::value...>::value,
+                                  int>::type
+          = 0>
+auto visit_masked(Visitor&& visitor, Optionals&&... optionals)
+    -> decltype(detail::visit_optional_impl(std::forward<Visitor>(visitor),
+                                            std::forward<Optionals>(optionals)...))
+{
+    return detail::visit_masked_impl<
+        !detail::visitor_allow_incomplete<Visitor>::value, decltype(std::forward<Visitor>(visitor)),
+        decltype(std::forward<Optionals>(optionals))...>::call(std::forward<Visitor>(visitor),
+                                                               std::forward<Optionals>(
+                                                                   optionals)...);
+}
+
 /// \exclude
 namespace detail
 {
@@ -224,8 +376,8 @@ namespace detail
                                            std::forward<Visitor>(visitor),
                                            std::forward<Args>(args)..., nullvar))>::type
         {
-            DEBUG_ASSERT(!variant.has_value(), assert_handler{},
-                         "it has a value but we are in this overload?!");
+            TYPE_SAFE_DETAIL_ASSERT(!variant.has_value(), assert_handler{},
+                                    "it has a value but we are in this overload?!");
             return visit_variant_impl<AllowIncomplete, Visitor>::call(std::forward<Visitor>(
                                                                           visitor),
                                                                       std::forward<Args>(args)...,
@@ -241,8 +393,8 @@ namespace detail
                                         std::forward<Visitor>(visitor), std::forward<Args>(args)...,
                                         get_dummy_type(variant)))>::type
         {
-            DEBUG_ASSERT(!variant.has_value(), assert_handler{},
-                         "it has a value but we are in this overload?!");
+            TYPE_SAFE_DETAIL_ASSERT(!variant.has_value(), assert_handler{},
+                                    "it has a value but we are in this overload?!");
             DEBUG_UNREACHABLE(precondition_error_handler{}, "variant in invalid state for visit");
             return visit_variant_impl<AllowIncomplete, Visitor>::call(std::forward<Visitor>(
                                                                           visitor),
@@ -272,6 +424,48 @@ namespace detail
                                        std::forward<Variant>(variant), std::forward<Args>(args)...);
         }
 
+        template <typename R, typename... Args>
+        static R call_empty(Visitor&& visitor, Variant&& variant, Args&&... args)
+        {
+            return call_type<visit_variant_impl>(std::forward<Visitor>(visitor), variant_types<>{},
+                                                 std::forward<Variant>(variant),
+                                                 std::forward<Args>(args)...);
+        }
+
+        template <typename R, typename T, typename... Args>
+        static R call_value(Visitor&& visitor, Variant&& variant, Args&&... args)
+        {
+            return visit_variant_impl<AllowIncomplete,
+                                      Visitor>::call(std::forward<Visitor>(visitor),
+                                                     std::forward<Args>(args)...,
+                                                     std::forward<Variant>(variant).value(
+                                                         variant_type<T>{}));
+        }
+
+        // flat dispatch table indexed by the type id, entry 0 is the empty state
+        template <typename... Ts, typename... Args>
+        static auto dispatch(variant_types<Ts...>, Visitor&& visitor, Variant&& variant,
+                             Args&&... args)
+            -> decltype(call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
+                                                      typename std::decay<Variant>::type::types{},
+                                                      std::forward<Variant>(variant),
+                                                      std::forward<Args>(args)...))
+        {
+            using return_type
+                = decltype(call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
+                                                         typename std::decay<
+                                                             Variant>::type::types{},
+                                                         std::forward<Variant>(variant),
+                                                         std::forward<Args>(args)...));
+            using callback = return_type (*)(Visitor&&, Variant&&, Args&&...);
+
+            static constexpr callback table[]
+                = {&call_empty<return_type, Args...>, &call_value<return_type, Ts, Args...>...};
+            return table[get(variant.type())](std::forward<Visitor>(visitor),
+                                              std::forward<Variant>(variant),
+                                              std::forward<Args>(args)...);
+        }
+
     public:
         template <typename... Args>
         static auto call(Visitor&& visitor, Variant&& variant, Args&&... args)
@@ -280,10 +474,9 @@ namespace detail
                                                       std::forward<Variant>(variant),
                                                       std::forward<Args>(args)...))
         {
-            return visit_variant_impl::call_type<
-                visit_variant_impl>(std::forward<Visitor>(visitor),
-                                    typename std::decay<Variant>::type::types{},
-                                    std::forward<Variant>(variant), std::forward<Args>(args)...);
+            return dispatch(typename std::decay<Variant>::type::types{},
+                            std::forward<Visitor>(visitor), std::forward<Variant>(variant),
+                            std::forward<Args>(args)...);
         }
     };
 
@@ -300,8 +493,10 @@ namespace detail
                     std::forward<Visitor>(visitor), std::forward<Rest>(rest)...,
                     std::forward<Args>(args)..., nullvar))>::type
         {
-            DEBUG_ASSERT(std::decay<Variant>::type::allow_empty::value && !variant.has_value(),
-                         precondition_error_handler{}, "variant in invalid state for visitor");
+            TYPE_SAFE_DETAIL_ASSERT(std::decay<Variant>::type::allow_empty::value
+                                        && !variant.has_value(),
+                                    precondition_error_handler{},
+                                    "variant in invalid state for visitor");
             return visit_variant_impl<AllowIncomplete, Visitor,
                                       Rest...>::call(std::forward<Visitor>(visitor),
                                                      std::forward<Rest>(rest)...,
@@ -318,8 +513,8 @@ namespace detail
                     std::forward<Visitor>(visitor), std::forward<Rest>(rest)...,
                     std::forward<Args>(args)..., get_dummy_type(variant)))>::type
         {
-            DEBUG_ASSERT(!variant.has_value(), assert_handler{},
-                         "it has a value but we are in this overload?!");
+            TYPE_SAFE_DETAIL_ASSERT(!variant.has_value(), assert_handler{},
+                                    "it has a value but we are in this overload?!");
             DEBUG_UNREACHABLE(precondition_error_handler{}, "variant in invalid state for visit");
             return visit_variant_impl<AllowIncomplete, Visitor,
                                       Rest...>::call(std::forward<Visitor>(visitor),
@@ -354,6 +549,55 @@ namespace detail
                                        std::forward<Args>(args)...);
         }
 
+        template <typename R, typename... Args>
+        static R call_empty(Visitor&& visitor, Variant&& variant, Rest&&... rest, Args&&... args)
+        {
+            return call_type<visit_variant_impl>(std::forward<Visitor>(visitor), variant_types<>{},
+                                                 std::forward<Variant>(variant),
+                                                 std::forward<Rest>(rest)...,
+                                                 std::forward<Args>(args)...);
+        }
+
+        template <typename R, typename T, typename... Args>
+        static R call_value(Visitor&& visitor, Variant&& variant, Rest&&... rest, Args&&... args)
+        {
+            return visit_variant_impl<AllowIncomplete, Visitor,
+                                      Rest...>::call(std::forward<Visitor>(visitor),
+                                                     std::forward<Rest>(rest)...,
+                                                     std::forward<Args>(args)...,
+                                                     std::forward<Variant>(variant).value(
+                                                         variant_type<T>{}));
+        }
+
+        // flat dispatch table indexed by the type id, entry 0 is the empty state;
+        // each variant of a multi variant visit is dispatched through its own table,
+        // so the whole visit is one indexed call per variant instead of nested chains
+        template <typename... Ts, typename... Args>
+        static auto dispatch(variant_types<Ts...>, Visitor&& visitor, Variant&& variant,
+                             Rest&&... rest, Args&&... args)
+            -> decltype(call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
+                                                      typename std::decay<Variant>::type::types{},
+                                                      std::forward<Variant>(variant),
+                                                      std::forward<Rest>(rest)...,
+                                                      std::forward<Args>(args)...))
+        {
+            using return_type
+                = decltype(call_type<visit_variant_impl>(std::forward<Visitor>(visitor),
+                                                         typename std::decay<
+                                                             Variant>::type::types{},
+                                                         std::forward<Variant>(variant),
+                                                         std::forward<Rest>(rest)...,
+                                                         std::forward<Args>(args)...));
+            using callback = return_type (*)(Visitor&&, Variant&&, Rest&&..., Args&&...);
+
+            static constexpr callback table[]
+                = {&call_empty<return_type, Args...>, &call_value<return_type, Ts, Args...>...};
+            return table[get(variant.type())](std::forward<Visitor>(visitor),
+                                              std::forward<Variant>(variant),
+                                              std::forward<Rest>(rest)...,
+                                              std::forward<Args>(args)...);
+        }
+
     public:
         template <typename... Args>
         static auto call(Visitor&& visitor, Variant&& variant, Rest&&... rest, Args&&... args)
@@ -363,11 +607,9 @@ namespace detail
                                                       std::forward<Rest>(rest)...,
                                                       std::forward<Args>(args)...))
         {
-            return visit_variant_impl::call_type<
-                visit_variant_impl>(std::forward<Visitor>(visitor),
-                                    typename std::decay<Variant>::type::types{},
-                                    std::forward<Variant>(variant), std::forward<Rest>(rest)...,
-                                    std::forward<Args>(args)...);
+            return dispatch(typename std::decay<Variant>::type::types{},
+                            std::forward<Visitor>(visitor), std::forward<Variant>(variant),
+                            std::forward<Rest>(rest)..., std::forward<Args>(args)...);
         }
     };
 
@@ -381,6 +623,88 @@ namespace detail
                                   Variants&&...>::call(std::forward<Visitor>(visitor),
                                                        std::forward<Variants>(variants)...);
     }
+
+    //=== visit_all ===//
+    template <bool AllowIncomplete, typename Visitor, typename Iterator, class Types>
+    class visit_all_impl;
+
+    template <bool AllowIncomplete, typename Visitor, typename Iterator, typename... Ts>
+    class visit_all_impl<AllowIncomplete, Visitor, Iterator, union_types<Ts...>>
+    {
+        using callback = void (*)(Iterator, const std::size_t*, std::size_t, Visitor&);
+
+        static void visit_empty(Iterator first, const std::size_t* indices, std::size_t count,
+                                Visitor& visitor)
+        {
+            for (auto i = std::size_t(0u); i != count; ++i)
+                visit_variant(visitor, first[indices[i]]);
+        }
+
+        template <typename T>
+        static void visit_value(Iterator first, const std::size_t* indices, std::size_t count,
+                                Visitor& visitor)
+        {
+            // a type homogeneous loop, the visitor body can be inlined and vectorized
+            for (auto i = std::size_t(0u); i != count; ++i)
+                visit_variant_impl<AllowIncomplete, Visitor&>::call(visitor,
+                                                                    first[indices[i]].value(
+                                                                        variant_type<T>{}));
+        }
+
+    public:
+        static void visit(Iterator first, Iterator last, Visitor& visitor)
+        {
+            constexpr auto no_ids = sizeof...(Ts) + 1u; // one for each type plus the empty state
+
+            auto size = std::size_t(last - first);
+
+            // counting sort of the element indices by discriminant
+            std::size_t count[no_ids] = {};
+            for (auto iter = first; iter != last; ++iter)
+                ++count[get(iter->type())];
+
+            std::size_t offset[no_ids];
+            auto        sum = std::size_t(0u);
+            for (auto id = std::size_t(0u); id != no_ids; ++id)
+            {
+                offset[id] = sum;
+                sum += count[id];
+            }
+
+            std::vector<std::size_t> indices(size);
+            for (auto i = std::size_t(0u); i != size; ++i)
+                indices[offset[get(first[i].type())]++] = i;
+
+            // dispatch each discriminant once and process its elements as one batch
+            static constexpr callback table[] = {&visit_empty, &visit_value<Ts>...};
+
+            auto begin = std::size_t(0u);
+            for (auto id = std::size_t(0u); id != no_ids; ++id)
+            {
+                if (count[id] != 0u)
+                    table[id](first, indices.data() + begin, count[id], visitor);
+                begin += count[id];
+            }
+        }
+    };
+
+    template <typename Iterator, typename Visitor>
+    void visit_all_variant(std::random_access_iterator_tag, Iterator first, Iterator last,
+                           Visitor&& visitor)
+    {
+        using variant_t = typename std::decay<decltype(*first)>::type;
+        visit_all_impl<visitor_allow_incomplete<Visitor>::value, Visitor, Iterator,
+                       typename variant_t::types>::visit(first, last, visitor);
+    }
+
+    template <typename Iterator, typename Visitor>
+    void visit_all_variant(std::input_iterator_tag, Iterator first, Iterator last,
+                           Visitor&& visitor)
+    {
+        // cannot index the elements, visit them as a stream
+        for (; first != last; ++first)
+            visit_variant(visitor, *first);
+    }
 } // namespace detail
 
 /// Visits a [ts::basic_variant]().
@@ -403,6 +727,92 @@ auto visit(Visitor&& visitor, Variants&&... variants)
     return detail::visit_variant(std::forward<Visitor>(visitor),
                                  std::forward<Variants>(variants)...);
 }
+
+/// Visits a range of [ts::basic_variant]()s.
+/// \effects Calls `visit(visitor, variant)` for every variant in the range `[first, last)`,
+/// but discards the results of the calls.
+/// For random access iterators the elements are not visited in order:
+/// one pass groups the element indices by the type currently stored,
+/// then all elements storing the same type are visited as one batch,
+/// so the visitor body runs in type homogeneous loops
+/// instead of dispatching on every element of a mixed stream.
+/// For other iterators the elements are simply visited in order.
+/// \module variant
+template <typename Iterator, class Visitor,
+          typename = typename std::enable_if<
+              detail::is_variant<decltype(*std::declval<Iterator&>())>::value>::type>
+void visit_all(Iterator first, Iterator last, Visitor&& visitor)
+{
+    detail::visit_all_variant(typename std::iterator_traits<Iterator>::iterator_category{}, first,
+                              last, std::forward<Visitor>(visitor));
+}
+
+#if TYPE_SAFE_USE_PARALLEL_VISIT
+/// \exclude
+namespace detail
+{
+    template <typename Iterator, typename Visitor>
+    void visit_all_parallel(Iterator first, Iterator last, const Visitor& visitor)
+    {
+        auto size = std::size_t(last - first);
+
+        auto hardware = std::size_t(std::thread::hardware_concurrency());
+        auto threads  = hardware == 0u ? std::size_t(1) : hardware;
+        if (threads > size)
+            threads = size;
+
+        if (threads < 2u)
+        {
+            auto local = visitor;
+            visit_all_variant(std::random_access_iterator_tag{}, first, last, local);
+            return;
+        }
+
+        auto chunk = (size + threads - 1u) / threads;
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (auto begin = std::size_t(0u); begin < size; begin += chunk)
+        {
+            auto end = begin + chunk < size ? begin + chunk : size;
+            workers.emplace_back([first, begin, end, &visitor] {
+                // every thread visits its partition with its own copy of the visitor,
+                // so there is no shared mutable state between the threads
+                auto local = visitor;
+                visit_all_variant(std::random_access_iterator_tag{}, first + std::ptrdiff_t(begin),
+                                  first + std::ptrdiff_t(end), local);
+            });
+        }
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+} // namespace detail
+
+/// Visits a range of [ts::basic_variant]()s with an execution policy.
+/// \effects Like the range overload of [ts::visit_all](),
+/// but for the parallel policies the range is partitioned across the hardware threads,
+/// each visiting its partition grouped by discriminant.
+/// Every thread operates on its own copy of `visitor`,
+/// so the visitor must be copyable
+/// and must not rely on shared mutable state unless it synchronizes itself.
+/// \notes Requires random access iterators.
+/// If a visitor call exits with an exception, `std::terminate()` is called,
+/// like for the parallel standard library algorithms.
+/// \module variant
+template <class ExecutionPolicy, typename Iterator, class Visitor,
+          typename = typename std::enable_if<
+              std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value
+              && detail::is_variant<decltype(*std::declval<Iterator&>())>::value>::type>
+void visit(ExecutionPolicy&&, Iterator first, Iterator last, Visitor&& visitor)
+{
+    if (std::is_same<typename std::decay<ExecutionPolicy>::type,
+                     std::execution::sequenced_policy>::value)
+        visit_all(first, last, std::forward<Visitor>(visitor));
+    else
+        detail::visit_all_parallel(first, last, visitor);
+}
+#endif
 } // namespace type_safe
 
 #endif // TYPE_SAFE_VISITOR_HPP_INCLUDED
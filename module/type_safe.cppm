@@ -0,0 +1,101 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// The named module interface for the whole library.
+//
+// Module-enabled consumers write `import type_safe;` and parse the library once,
+// instead of re-parsing the template-heavy headers in every translation unit.
+// Everything is attached to the global module with C++ language linkage,
+// so mixing `import type_safe;` and `#include <type_safe/...>` across translation
+// units is not an ODR violation.
+// \notes Macros do not leave a module; a consumer that needs the configuration
+// macros (e.g. `TYPE_SAFE_THROW`) additionally includes `<type_safe/config.hpp>`.
+
+module;
+
+// The global module fragment pulls in everything the headers include from the
+// standard library (and debug_assert), so those entities stay attached to the
+// global module instead of this one.
+#include <atomic>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iosfwd>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#if defined(__has_include)
+#    if __has_include(<compare>)
+#        include <compare>
+#    endif
+#    if __has_include(<coroutine>)
+#        include <coroutine>
+#    endif
+#    if __has_include(<execution>)
+#        include <execution>
+#    endif
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
+
+#include <debug_assert.hpp>
+
+export module type_safe;
+
+export extern "C++"
+{
+#include <type_safe/config.hpp>
+
+#include <type_safe/arithmetic_policy.hpp>
+#include <type_safe/atomic.hpp>
+#include <type_safe/boolean.hpp>
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/bulk_operations.hpp>
+#include <type_safe/charconv.hpp>
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/constrained_type.hpp>
+#include <type_safe/coroutine.hpp>
+#include <type_safe/deferred_construction.hpp>
+#include <type_safe/divider.hpp>
+#include <type_safe/downcast.hpp>
+#include <type_safe/flag.hpp>
+#include <type_safe/flag_set.hpp>
+#include <type_safe/flag_set_column.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/index.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/math.hpp>
+#include <type_safe/narrow_cast.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/optional_ref.hpp>
+#include <type_safe/optional_vector.hpp>
+#include <type_safe/output_parameter.hpp>
+#include <type_safe/packed_bool_vector.hpp>
+#include <type_safe/persist.hpp>
+#include <type_safe/raw_union.hpp>
+#include <type_safe/recursive_variant.hpp>
+#include <type_safe/reference.hpp>
+#include <type_safe/soa_vector.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/tagged_union.hpp>
+#include <type_safe/types.hpp>
+#include <type_safe/variant.hpp>
+#include <type_safe/violation_handler.hpp>
+#include <type_safe/visitor.hpp>
+}
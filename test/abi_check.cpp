@@ -0,0 +1,87 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+// Build-time verification of the layout and code-gen properties the zero-overhead
+// claim rests on: sizes, triviality of the special members, and storage alignment.
+// A change that breaks one of these static_asserts fails the build of the
+// `type_safe_abi_check` target instead of showing up in production profiles.
+
+#include <type_safe/boolean.hpp>
+#include <type_safe/compact_optional.hpp>
+#include <type_safe/floating_point.hpp>
+#include <type_safe/integer.hpp>
+#include <type_safe/optional.hpp>
+#include <type_safe/strong_typedef.hpp>
+#include <type_safe/tagged_union.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ts = type_safe;
+
+//=== integer ===//
+// same size and representation as the raw type, passed in registers the same way
+static_assert(sizeof(ts::integer<std::int8_t>) == sizeof(std::int8_t), "");
+static_assert(sizeof(ts::integer<std::int32_t>) == sizeof(std::int32_t), "");
+static_assert(sizeof(ts::integer<std::int64_t>) == sizeof(std::int64_t), "");
+static_assert(sizeof(ts::integer<std::uint64_t>) == sizeof(std::uint64_t), "");
+static_assert(alignof(ts::integer<std::int64_t>) == alignof(std::int64_t), "");
+
+static_assert(std::is_trivially_copyable<ts::integer<std::int32_t>>::value, "");
+static_assert(std::is_trivially_destructible<ts::integer<std::int32_t>>::value, "");
+
+//=== floating_point ===//
+static_assert(sizeof(ts::floating_point<float>) == sizeof(float), "");
+static_assert(sizeof(ts::floating_point<double>) == sizeof(double), "");
+static_assert(alignof(ts::floating_point<double>) == alignof(double), "");
+
+static_assert(std::is_trivially_copyable<ts::floating_point<double>>::value, "");
+static_assert(std::is_trivially_destructible<ts::floating_point<double>>::value, "");
+
+//=== boolean ===//
+static_assert(sizeof(ts::boolean) == sizeof(bool), "");
+static_assert(std::is_trivially_copyable<ts::boolean>::value, "");
+static_assert(std::is_trivially_destructible<ts::boolean>::value, "");
+
+//=== strong_typedef ===//
+namespace
+{
+struct meter : ts::strong_typedef<meter, double>, ts::strong_typedef_op::addition<meter>
+{
+    using strong_typedef::strong_typedef;
+};
+} // namespace
+
+static_assert(sizeof(meter) == sizeof(double), "");
+static_assert(alignof(meter) == alignof(double), "");
+static_assert(std::is_standard_layout<meter>::value, "");
+static_assert(std::is_trivially_copyable<meter>::value, "");
+static_assert(std::is_trivially_destructible<meter>::value, "");
+
+//=== optional ===//
+// value plus flag, padded; must not grow beyond two words for register passing
+static_assert(sizeof(ts::optional<std::int32_t>) == 2 * sizeof(std::int32_t), "");
+static_assert(sizeof(ts::optional<void*>) == 2 * sizeof(void*), "");
+
+//=== compact_optional ===//
+// the policies encode the empty state in a niche, no flag may be added
+static_assert(sizeof(ts::compact_optional<ts::compact_bool_policy<bool>>) == sizeof(char), "");
+static_assert(sizeof(ts::compact_optional<ts::compact_integer_policy<std::int32_t, -1>>)
+                  == sizeof(std::int32_t),
+              "");
+static_assert(sizeof(ts::compact_optional<ts::compact_floating_point_policy<double>>)
+                  == sizeof(double),
+              "");
+
+//=== tagged_union ===//
+// storage as aligned as the most aligned member, no looser and no stricter
+static_assert(alignof(ts::tagged_union<char, double>) >= alignof(double), "");
+static_assert(sizeof(ts::tagged_union<char, std::int32_t>)
+                  <= 2 * sizeof(ts::tagged_union<char, std::int32_t>::type_id),
+              "");
+
+int main()
+{
+    return 0;
+}
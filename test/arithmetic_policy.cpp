@@ -76,3 +76,88 @@ TEST_CASE("over/underflow")
         REQUIRE(!detail::will_modulo_error(detail::signed_integer_tag{}, 1, 1));
     }
 }
+
+TEST_CASE("saturating_arithmetic")
+{
+    SECTION("unsigned")
+    {
+        auto max = std::numeric_limits<unsigned>::max();
+
+        REQUIRE(saturating_arithmetic::do_addition(1u, 2u) == 3u);
+        REQUIRE(saturating_arithmetic::do_addition(max, 1u) == max);
+        REQUIRE(saturating_arithmetic::do_addition(max - 5u, 10u) == max);
+
+        REQUIRE(saturating_arithmetic::do_subtraction(3u, 2u) == 1u);
+        REQUIRE(saturating_arithmetic::do_subtraction(0u, 1u) == 0u);
+        REQUIRE(saturating_arithmetic::do_subtraction(5u, 6u) == 0u);
+
+        REQUIRE(saturating_arithmetic::do_multiplication(2u, 3u) == 6u);
+        REQUIRE(saturating_arithmetic::do_multiplication(max, 2u) == max);
+
+        REQUIRE(saturating_arithmetic::do_division(6u, 2u) == 3u);
+        REQUIRE(saturating_arithmetic::do_modulo(7u, 2u) == 1u);
+    }
+    SECTION("signed")
+    {
+        auto max = std::numeric_limits<int>::max();
+        auto min = std::numeric_limits<int>::min();
+
+        REQUIRE(saturating_arithmetic::do_addition(1, 2) == 3);
+        REQUIRE(saturating_arithmetic::do_addition(max, 1) == max);
+        REQUIRE(saturating_arithmetic::do_addition(min, -1) == min);
+
+        REQUIRE(saturating_arithmetic::do_subtraction(1, 2) == -1);
+        REQUIRE(saturating_arithmetic::do_subtraction(min, 1) == min);
+        REQUIRE(saturating_arithmetic::do_subtraction(max, -1) == max);
+
+        REQUIRE(saturating_arithmetic::do_multiplication(2, -3) == -6);
+        REQUIRE(saturating_arithmetic::do_multiplication(max, 2) == max);
+        REQUIRE(saturating_arithmetic::do_multiplication(max, -2) == min);
+        REQUIRE(saturating_arithmetic::do_multiplication(min, -1) == max);
+
+        REQUIRE(saturating_arithmetic::do_division(6, -2) == -3);
+        REQUIRE(saturating_arithmetic::do_division(min, -1) == max);
+        REQUIRE(saturating_arithmetic::do_modulo(7, 2) == 1);
+    }
+}
+
+TEST_CASE("wrapping_arithmetic")
+{
+    SECTION("unsigned")
+    {
+        auto max = std::numeric_limits<unsigned>::max();
+
+        REQUIRE(wrapping_arithmetic::do_addition(1u, 2u) == 3u);
+        REQUIRE(wrapping_arithmetic::do_addition(max, 1u) == 0u);
+        REQUIRE(wrapping_arithmetic::do_addition(max, max) == max - 1u);
+
+        REQUIRE(wrapping_arithmetic::do_subtraction(3u, 2u) == 1u);
+        REQUIRE(wrapping_arithmetic::do_subtraction(0u, 1u) == max);
+
+        REQUIRE(wrapping_arithmetic::do_multiplication(2u, 3u) == 6u);
+        REQUIRE(wrapping_arithmetic::do_multiplication(max, 2u) == max - 1u);
+
+        REQUIRE(wrapping_arithmetic::do_division(7u, 2u) == 3u);
+        REQUIRE(wrapping_arithmetic::do_modulo(7u, 2u) == 1u);
+    }
+    SECTION("signed")
+    {
+        auto max = std::numeric_limits<int>::max();
+        auto min = std::numeric_limits<int>::min();
+
+        REQUIRE(wrapping_arithmetic::do_addition(1, 2) == 3);
+        REQUIRE(wrapping_arithmetic::do_addition(max, 1) == min);
+        REQUIRE(wrapping_arithmetic::do_addition(min, -1) == max);
+
+        REQUIRE(wrapping_arithmetic::do_subtraction(1, 2) == -1);
+        REQUIRE(wrapping_arithmetic::do_subtraction(min, 1) == max);
+
+        REQUIRE(wrapping_arithmetic::do_multiplication(2, -3) == -6);
+        REQUIRE(wrapping_arithmetic::do_multiplication(max, 2) == -2);
+
+        REQUIRE(wrapping_arithmetic::do_division(7, -2) == -3);
+        REQUIRE(wrapping_arithmetic::do_division(min, -1) == min);
+        REQUIRE(wrapping_arithmetic::do_modulo(7, 2) == 1);
+        REQUIRE(wrapping_arithmetic::do_modulo(min, -1) == 0);
+    }
+}
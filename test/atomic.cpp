@@ -0,0 +1,85 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/atomic.hpp>
+
+#include <catch.hpp>
+
+#include <thread>
+
+using namespace type_safe;
+
+namespace
+{
+struct counter_id : strong_typedef<counter_id, std::uint64_t>
+{
+    using strong_typedef::strong_typedef;
+};
+} // namespace
+
+TEST_CASE("atomic")
+{
+    SECTION("integer")
+    {
+        using int_t = integer<std::uint64_t>;
+        atomic<int_t> counter(int_t(0u));
+
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 0u);
+
+        counter.store(int_t(5u));
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 5u);
+
+        auto old = counter.fetch_add(int_t(3u));
+        REQUIRE(static_cast<std::uint64_t>(old) == 5u);
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 8u);
+
+        old = counter.fetch_sub(int_t(1u));
+        REQUIRE(static_cast<std::uint64_t>(old) == 8u);
+
+        old = counter.fetch_or(int_t(8u));
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 15u);
+
+        REQUIRE(static_cast<std::uint64_t>(++counter) == 16u);
+        REQUIRE(static_cast<std::uint64_t>(counter--) == 16u);
+
+        auto expected = int_t(15u);
+        REQUIRE(counter.compare_exchange_strong(expected, int_t(42u)));
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 42u);
+
+        expected = int_t(0u);
+        REQUIRE(!counter.compare_exchange_strong(expected, int_t(1u)));
+        REQUIRE(static_cast<std::uint64_t>(expected) == 42u);
+    }
+    SECTION("boolean")
+    {
+        atomic<boolean> flag(boolean(false));
+
+        REQUIRE(!static_cast<bool>(flag.load()));
+        REQUIRE(!static_cast<bool>(flag.exchange(boolean(true))));
+        REQUIRE(static_cast<bool>(flag.load()));
+    }
+    SECTION("strong typedef")
+    {
+        atomic<counter_id> id(counter_id(0u));
+
+        auto old = id.fetch_add(counter_id(1u));
+        REQUIRE(get(old) == 0u);
+        REQUIRE(get(id.load()) == 1u);
+    }
+    SECTION("concurrent increments")
+    {
+        using int_t = integer<std::uint64_t>;
+        atomic<int_t> counter(int_t(0u));
+
+        auto work = [&] {
+            for (auto i = 0; i != 10000; ++i)
+                counter.fetch_add(int_t(1u));
+        };
+        std::thread t1(work), t2(work);
+        t1.join();
+        t2.join();
+
+        REQUIRE(static_cast<std::uint64_t>(counter.load()) == 20000u);
+    }
+}
@@ -8,6 +8,8 @@
 
 #include <type_safe/integer.hpp>
 
+#include <vector>
+
 using namespace type_safe;
 
 TEST_CASE("constraints::less")
@@ -152,6 +154,21 @@ TEST_CASE("bounded literal")
         bounded = make_bounded(integer<int>(50), 0_bound, 100_bound);
     REQUIRE(bounded.get_constraint().get_lower_bound() == 0);
     REQUIRE(bounded.get_constraint().get_upper_bound() == 100);
+
+    SECTION("static value")
+    {
+        // the range check is a static_assert, nothing left for the verifier
+        auto static_bounded = make_bounded(5_bounded, 0_bound, 100_bound);
+        REQUIRE(static_bounded.get_value() == 5);
+        REQUIRE(static_bounded.get_constraint().get_lower_bound() == 0);
+        REQUIRE(static_bounded.get_constraint().get_upper_bound() == 100);
+
+        auto negative = make_bounded(-5_bounded, -10_bound, 10_bound);
+        REQUIRE(negative.get_value() == -5);
+
+        auto unsigned_bounded = make_bounded(5_boundedu, 0_boundu, 100_boundu);
+        REQUIRE(unsigned_bounded.get_value() == 5u);
+    }
 }
 
 TEST_CASE("bounded_type")
@@ -344,3 +361,92 @@ TEST_CASE("clamped_type")
     REQUIRE(mixed.get_constraint().get_lower_bound() == 0);
     REQUIRE(mixed.get_constraint().get_upper_bound() == 42);
 }
+
+TEST_CASE("constraints::bounded unsigned zero lower bound")
+{
+    // static, closed lower bound of zero for an unsigned value:
+    // only the upper compare remains
+    constraints::closed_interval<unsigned, std::integral_constant<unsigned, 0>,
+                                 std::integral_constant<unsigned, 42>>
+        p;
+    REQUIRE(p(0u));
+    REQUIRE(p(21u));
+    REQUIRE(p(42u));
+    REQUIRE(!p(43u));
+
+    // literal bounds work as well
+    auto bounded = make_bounded(21u, 0_boundu, 42_boundu);
+    REQUIRE(bounded.get_value() == 21u);
+}
+
+namespace
+{
+struct container_size_tag
+{};
+} // namespace
+
+TEST_CASE("constraints::shared_bound")
+{
+    using size_bound  = constraints::shared_bound<unsigned, container_size_tag>;
+    size_bound::value = 10u;
+
+    SECTION("constraint")
+    {
+        constraints::less<unsigned, size_bound> p;
+        REQUIRE(p.get_bound() == 10u);
+        REQUIRE(p(9u));
+        REQUIRE(!p(10u));
+
+        // all constraints reference the same out-of-line value
+        size_bound::value = 20u;
+        REQUIRE(p.get_bound() == 20u);
+        REQUIRE(p(15u));
+        REQUIRE(!p(20u));
+    }
+    SECTION("bounded_type")
+    {
+        using index
+            = bounded_type<unsigned, true, false, std::integral_constant<unsigned, 0>, size_bound>;
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+        // neither the static nor the shared bound occupies storage per object
+        static_assert(sizeof(index) == sizeof(unsigned), "");
+#endif
+
+        index i(5u);
+        REQUIRE(i.get_value() == 5u);
+        REQUIRE(i.get_constraint().get_upper_bound() == 10u);
+
+        size_bound::value = 20u;
+        i                 = 15u;
+        REQUIRE(i.get_value() == 15u);
+    }
+}
+
+TEST_CASE("clamp_range")
+{
+    constraints::closed_interval<int> interval(0, 42);
+
+    SECTION("pointer and size")
+    {
+        int buffer[] = {-5, 0, 21, 42, 100};
+        clamp_range(interval, buffer, 5u);
+
+        REQUIRE(buffer[0] == 0);
+        REQUIRE(buffer[1] == 0);
+        REQUIRE(buffer[2] == 21);
+        REQUIRE(buffer[3] == 42);
+        REQUIRE(buffer[4] == 42);
+    }
+    SECTION("container")
+    {
+        std::vector<double> values;
+        for (auto i = 0; i != 100; ++i)
+            values.push_back(double(i) - 50.);
+
+        constraints::closed_interval<double> dinterval(0., 42.);
+        clamp_range(dinterval, values);
+
+        for (auto i = 0; i != 100; ++i)
+            REQUIRE(values[std::size_t(i)] == clamp(dinterval, double(i) - 50.));
+    }
+}
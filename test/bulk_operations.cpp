@@ -0,0 +1,230 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/bulk_operations.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+using namespace type_safe;
+
+TEST_CASE("checked_transform")
+{
+    using int_t = integer<int, checked_arithmetic>;
+    auto max    = std::numeric_limits<int>::max();
+
+    SECTION("scalar operand")
+    {
+        std::vector<int_t> src(100u, int_t(2));
+        std::vector<int_t> dst(100u, int_t(0));
+        src[42u] = int_t(40);
+
+        checked_transform(cref(src.data(), src.size()), ref(dst.data(), dst.size()), int_t(2),
+                          bulk_add);
+        REQUIRE(static_cast<int>(dst[0u]) == 4);
+        REQUIRE(static_cast<int>(dst[42u]) == 42);
+
+        checked_transform(cref(src.data(), src.size()), ref(dst.data(), dst.size()), int_t(3),
+                          bulk_mul);
+        REQUIRE(static_cast<int>(dst[0u]) == 6);
+        REQUIRE(static_cast<int>(dst[42u]) == 120);
+
+        checked_transform(cref(src.data(), src.size()), ref(dst.data(), dst.size()), int_t(1),
+                          bulk_sub);
+        REQUIRE(static_cast<int>(dst[0u]) == 1);
+        REQUIRE(static_cast<int>(dst[42u]) == 39);
+    }
+    SECTION("range operand")
+    {
+        std::vector<int_t> a(70u, int_t(5));
+        std::vector<int_t> b(70u, int_t(7));
+        std::vector<int_t> dst(70u, int_t(0));
+
+        checked_transform(cref(a.data(), a.size()), cref(b.data(), b.size()),
+                          ref(dst.data(), dst.size()), bulk_mul);
+        for (auto& val : dst)
+            REQUIRE(static_cast<int>(val) == 35);
+    }
+    SECTION("overflow raises the policy error")
+    {
+        std::vector<int_t> src(100u, int_t(1));
+        std::vector<int_t> dst(100u, int_t(0));
+        src[99u] = int_t(max);
+
+        REQUIRE_THROWS_AS(checked_transform(cref(src.data(), src.size()),
+                                            ref(dst.data(), dst.size()), int_t(1), bulk_add),
+                          checked_arithmetic::error);
+        // the blocks before the failing one are already transformed
+        REQUIRE(static_cast<int>(dst[0u]) == 2);
+    }
+}
+
+TEST_CASE("narrow_cast_range")
+{
+    SECTION("raw integers")
+    {
+        std::vector<std::int64_t> src{1, 2, 3, 42};
+        std::vector<std::int32_t> dst(4u, 0);
+
+        auto result = narrow_cast_range(cref(src.data(), src.size()), ref(dst.data(), dst.size()));
+        REQUIRE(result == src.size());
+        REQUIRE(dst[3] == 42);
+
+        src[2u] = std::int64_t(1) << 40;
+        dst.assign(4u, 0);
+        result = narrow_cast_range(cref(src.data(), src.size()), ref(dst.data(), dst.size()));
+        REQUIRE(result == 2u);
+        REQUIRE(dst[0] == 0);
+    }
+    SECTION("wrapped integers")
+    {
+        std::vector<integer<std::int64_t>> src(10u, integer<std::int64_t>(7));
+        std::vector<integer<std::int32_t>> dst(10u, integer<std::int32_t>(0));
+
+        auto result = narrow_cast_range(cref(src.data(), src.size()), ref(dst.data(), dst.size()));
+        REQUIRE(result == src.size());
+        REQUIRE(static_cast<std::int32_t>(dst[9u]) == 7);
+    }
+    SECTION("floating point")
+    {
+        std::vector<floating_point<double>> src(4u, floating_point<double>(0.5));
+        std::vector<floating_point<float>>  dst(4u, floating_point<float>(0.f));
+
+        auto result = narrow_cast_range(cref(src.data(), src.size()), ref(dst.data(), dst.size()));
+        REQUIRE(result == src.size());
+        REQUIRE(static_cast<float>(dst[0u]) == 0.5f);
+    }
+}
+
+TEST_CASE("boolean bulk queries")
+{
+    std::vector<boolean> flags(100u, boolean(true));
+
+    REQUIRE(static_cast<bool>(all_of(cref(flags.data(), flags.size()))));
+    REQUIRE(static_cast<bool>(any_of(cref(flags.data(), flags.size()))));
+    REQUIRE(count(cref(flags.data(), flags.size())) == 100u);
+
+    flags[42u] = boolean(false);
+    REQUIRE(!static_cast<bool>(all_of(cref(flags.data(), flags.size()))));
+    REQUIRE(static_cast<bool>(any_of(cref(flags.data(), flags.size()))));
+    REQUIRE(count(cref(flags.data(), flags.size())) == 99u);
+
+    std::vector<boolean> none(100u, boolean(false));
+    REQUIRE(!static_cast<bool>(any_of(cref(none.data(), none.size()))));
+    REQUIRE(count(cref(none.data(), none.size())) == 0u);
+}
+
+TEST_CASE("partition")
+{
+    SECTION("even split on granule boundaries")
+    {
+        auto chunks = partition(index_t(0u), index_t(256u), 4u);
+        REQUIRE(chunks.size() == 4u);
+
+        auto pos = index_t(0u);
+        for (auto& chunk : chunks)
+        {
+            REQUIRE(get(chunk.first) == get(pos));
+            // every boundary except the last is cache-line aligned
+            REQUIRE((get(chunk.last) % 64u == 0u || get(chunk.last) == 256u));
+            pos = chunk.last;
+        }
+        REQUIRE(get(pos) == 256u);
+        REQUIRE((chunks[0u].size() == 64u));
+    }
+    SECTION("uneven tail")
+    {
+        auto chunks = partition(index_t(0u), index_t(100u), 4u);
+        // only two granules of 64, so only two chunks
+        REQUIRE(chunks.size() == 2u);
+        REQUIRE(get(chunks[0u].last) == 64u);
+        REQUIRE(get(chunks[1u].last) == 100u);
+    }
+    SECTION("non-zero begin and custom granularity")
+    {
+        auto chunks = partition(index_t(10u), index_t(42u), 2u, 8u);
+        REQUIRE(chunks.size() == 2u);
+        REQUIRE(get(chunks[0u].first) == 10u);
+        // boundaries are multiples of the granularity from begin
+        REQUIRE((get(chunks[0u].last) - 10u) % 8u == 0u);
+        REQUIRE(get(chunks[1u].last) == 42u);
+    }
+    SECTION("empty range")
+    {
+        auto chunks = partition(index_t(42u), index_t(42u), 4u);
+        REQUIRE(chunks.empty());
+    }
+}
+
+TEST_CASE("parallel_for")
+{
+    std::vector<int> data(1000u, 0);
+
+    parallel_for(index_range{index_t(0u), index_t(data.size())},
+                 [&](index_t first, index_t last) {
+                     for (auto i = static_cast<std::size_t>(get(first));
+                          i != static_cast<std::size_t>(get(last)); ++i)
+                         data[i] += 1;
+                 });
+
+    // every index was visited exactly once
+    for (auto value : data)
+        REQUIRE(value == 1);
+
+    // a single chunk runs on the calling thread
+    auto calls = 0;
+    parallel_for(index_range{index_t(0u), index_t(10u)},
+                 [&](index_t first, index_t last) {
+                     ++calls;
+                     REQUIRE(get(first) == 0u);
+                     REQUIRE(get(last) == 10u);
+                 },
+                 1u);
+    REQUIRE(calls == 1);
+}
+
+TEST_CASE("construct_parallel")
+{
+    SECTION("full success")
+    {
+        std::vector<deferred_construction<std::string>> slots(1000u);
+
+        auto failed = construct_parallel(ref(slots.data(), slots.size()),
+                                         [](index_t i) {
+                                             return std::to_string(
+                                                 static_cast<std::size_t>(get(i)));
+                                         });
+        REQUIRE(failed.empty());
+        for (auto i = 0u; i != 1000u; ++i)
+        {
+            REQUIRE(slots[i].has_value());
+            REQUIRE(slots[i].value() == std::to_string(i));
+        }
+    }
+    SECTION("failed indices are recorded")
+    {
+        std::vector<deferred_construction<int>> slots(100u);
+
+        auto failed = construct_parallel(ref(slots.data(), slots.size()),
+                                         [](index_t i) {
+                                             if (get(i) % 10u == 0u)
+                                                 throw "no value";
+                                             return int(static_cast<std::size_t>(get(i)));
+                                         },
+                                         4u);
+        REQUIRE(failed.size() == 10u);
+        for (auto i = 0u; i != 10u; ++i)
+            REQUIRE(get(failed[i]) == 10u * i);
+
+        for (auto i = 0u; i != 100u; ++i)
+            if (i % 10u == 0u)
+                REQUIRE(!slots[i].has_value());
+            else
+            {
+                REQUIRE(slots[i].has_value());
+                REQUIRE(slots[i].value() == int(i));
+            }
+    }
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/charconv.hpp>
+
+#include <catch.hpp>
+
+#if TYPE_SAFE_USE_CHARCONV
+
+#    include <string>
+
+#    include <type_safe/bounded_type.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+struct id : strong_typedef<id, int>
+{
+    using strong_typedef::strong_typedef;
+};
+} // namespace
+
+TEST_CASE("charconv")
+{
+    char buffer[64];
+
+    SECTION("integer")
+    {
+        auto result = to_chars(buffer, buffer + 64, integer<int>(-42));
+        REQUIRE(result.ec == std::errc());
+        REQUIRE(std::string(buffer, result.ptr) == "-42");
+
+        integer<int> value(0);
+        auto         parse = from_chars(buffer, result.ptr, value);
+        REQUIRE(parse.ec == std::errc());
+        REQUIRE(static_cast<int>(value) == -42);
+
+        parse = from_chars(buffer, buffer, value);
+        REQUIRE(parse.ec != std::errc());
+        REQUIRE(static_cast<int>(value) == -42);
+    }
+#    if defined(__cpp_lib_to_chars)
+    SECTION("floating_point")
+    {
+        auto result = to_chars(buffer, buffer + 64, floating_point<double>(0.5));
+        REQUIRE(result.ec == std::errc());
+        REQUIRE(std::string(buffer, result.ptr) == "0.5");
+
+        floating_point<double> value(0.);
+        auto                   parse = from_chars(buffer, result.ptr, value);
+        REQUIRE(parse.ec == std::errc());
+        REQUIRE(static_cast<double>(value) == 0.5);
+    }
+#    endif
+    SECTION("strong typedef")
+    {
+        auto result = to_chars(buffer, buffer + 64, id(7));
+        REQUIRE(result.ec == std::errc());
+        REQUIRE(std::string(buffer, result.ptr) == "7");
+
+        id value(0);
+        auto parse = from_chars(buffer, result.ptr, value);
+        REQUIRE(parse.ec == std::errc());
+        REQUIRE(get(value) == 7);
+    }
+    SECTION("bounded_type")
+    {
+        auto bounded = make_bounded(50, 0, 100);
+
+        auto result = to_chars(buffer, buffer + 64, bounded);
+        REQUIRE(result.ec == std::errc());
+        REQUIRE(std::string(buffer, result.ptr) == "50");
+
+        buffer[0] = '9';
+        buffer[1] = '9';
+        auto parse = from_chars(buffer, buffer + 2, bounded);
+        REQUIRE(parse.ec == std::errc());
+        REQUIRE(bounded.get_value() == 99);
+    }
+}
+
+#endif
@@ -130,3 +130,171 @@ TEST_CASE("compact_container")
     s.destroy_value();
     REQUIRE(!s.has_value());
 }
+
+struct test_id : strong_typedef<test_id, unsigned>
+{
+    using strong_typedef::strong_typedef;
+};
+
+struct test_niche_type
+{
+    int value;
+
+    test_niche_type(int v) : value(v) {}
+
+    explicit operator int() const noexcept
+    {
+        return value;
+    }
+};
+
+namespace type_safe
+{
+template <>
+class custom_niche<test_niche_type>
+{
+public:
+    using value_type   = test_niche_type;
+    using storage_type = int;
+
+    static storage_type invalid_value() noexcept
+    {
+        return -1;
+    }
+
+    static bool is_invalid(const storage_type& storage) noexcept
+    {
+        return storage == -1;
+    }
+};
+} // namespace type_safe
+
+TEST_CASE("compact_optional_for")
+{
+    SECTION("integer")
+    {
+        static_assert(sizeof(compact_optional_for<unsigned>) == sizeof(unsigned), "");
+
+        compact_optional_for<unsigned> a;
+        REQUIRE(!a.has_value());
+
+        a = 0u;
+        REQUIRE(a.has_value());
+        REQUIRE(a.value() == 0u);
+
+        a = nullopt;
+        REQUIRE(!a.has_value());
+    }
+    SECTION("floating point")
+    {
+        static_assert(sizeof(compact_optional_for<double>) == sizeof(double), "");
+
+        compact_optional_for<double> a;
+        REQUIRE(!a.has_value());
+
+        a = 3.14;
+        REQUIRE(a.has_value());
+        REQUIRE(a.value() == 3.14);
+    }
+    SECTION("pointer")
+    {
+        static_assert(sizeof(compact_optional_for<int*>) == sizeof(int*), "");
+
+        compact_optional_for<int*> a;
+        REQUIRE(!a.has_value());
+
+        int obj = 42;
+        a       = &obj;
+        REQUIRE(a.has_value());
+        REQUIRE(a.value() == &obj);
+    }
+    SECTION("enum")
+    {
+        enum class test_enum : unsigned char
+        {
+            a,
+            b,
+        };
+        static_assert(sizeof(compact_optional_for<test_enum>) == sizeof(test_enum), "");
+
+        compact_optional_for<test_enum> a;
+        REQUIRE(!a.has_value());
+
+        compact_optional_for<test_enum> b(test_enum::b);
+        REQUIRE(b.has_value());
+        REQUIRE(b.value() == test_enum::b);
+
+        b.reset();
+        REQUIRE(!b.has_value());
+    }
+    SECTION("strong typedef")
+    {
+        static_assert(sizeof(compact_optional_for<test_id>) == sizeof(unsigned), "");
+
+        compact_optional_for<test_id> a;
+        REQUIRE(!a.has_value());
+
+        a = test_id(7u);
+        REQUIRE(a.has_value());
+        REQUIRE(get(a.value()) == 7u);
+    }
+    SECTION("custom niche")
+    {
+        static_assert(sizeof(compact_optional_for<test_niche_type>) == sizeof(int), "");
+
+        compact_optional_for<test_niche_type> a;
+        REQUIRE(!a.has_value());
+
+        a = test_niche_type{42};
+        REQUIRE(a.has_value());
+        REQUIRE(a.value().value == 42);
+    }
+}
+
+TEST_CASE("compact monadic operations")
+{
+    using compact_int = compact_optional<compact_integer_policy<int, -1>>;
+
+    SECTION("map stays compact")
+    {
+        compact_int a(42);
+        auto        b = a.map([](int i) { return i * 2; });
+        // same value type, so the result is still the compacted representation
+        static_assert(std::is_same<decltype(b), compact_int>::value, "");
+        static_assert(sizeof(compact_int) == sizeof(int), "");
+        REQUIRE(b.has_value());
+        REQUIRE(b.value() == 84);
+
+        compact_int empty;
+        REQUIRE(!empty.map([](int i) { return i + 1; }).has_value());
+
+        // a different value type decompresses
+        auto c = a.map([](int i) { return i + 0.5; });
+        static_assert(std::is_same<decltype(c), optional<double>>::value, "");
+        REQUIRE(c.value() == 42.5);
+    }
+    SECTION("map producing the invalid value")
+    {
+        // the niche cannot represent the invalid value, the result is empty instead
+        compact_int a(0);
+        auto        b = a.map([](int i) { return i - 1; });
+        REQUIRE(!b.has_value());
+    }
+    SECTION("value_or")
+    {
+        compact_int a(42);
+        REQUIRE(a.value_or(7) == 42);
+
+        compact_int empty;
+        REQUIRE(empty.value_or(7) == 7);
+    }
+    SECTION("with")
+    {
+        compact_int a(42);
+        with(a, [](int& i) { i *= 2; });
+        REQUIRE(a.value() == 84);
+
+        compact_int empty;
+        with(empty, [](int&) { REQUIRE(false); });
+    }
+}
@@ -6,6 +6,8 @@
 
 #include <catch.hpp>
 
+#include <vector>
+
 using namespace type_safe;
 
 struct test_verifier
@@ -105,6 +107,160 @@ TEST_CASE("constrained_type")
     }
 }
 
+struct counting_verifier
+{
+    static int count;
+
+    template <typename T, typename Predicate>
+    static T&& verify(T&& value, const Predicate& p)
+    {
+        REQUIRE(p(value));
+        ++count;
+        return std::forward<T>(value);
+    }
+};
+
+int counting_verifier::count;
+
+TEST_CASE("bulk_modify()")
+{
+    using my_int = constrained_type<int, test_predicate, counting_verifier>;
+
+    SECTION("verifies exactly once")
+    {
+        my_int a(4);
+
+        auto before = counting_verifier::count;
+        a.bulk_modify([&](int& value) {
+            // many mutations, even temporarily invalid ones
+            value = -1;
+            value += 43;
+            REQUIRE(counting_verifier::count == before);
+        });
+        REQUIRE(counting_verifier::count == before + 1);
+        REQUIRE(*a == 42);
+    }
+    SECTION("additional arguments")
+    {
+        my_int a(4);
+        a.bulk_modify([](int& value, int summand) { value += summand; }, 2);
+        REQUIRE(*a == 6);
+    }
+    SECTION("reference")
+    {
+        auto value = 5;
+
+        constrained_ref<int, test_predicate, counting_verifier> ref(value);
+
+        auto before = counting_verifier::count;
+        ref.bulk_modify([](int& v) { v = 11; });
+        REQUIRE(counting_verifier::count == before + 1);
+        REQUIRE(value == 11);
+    }
+    SECTION("throwing verifier")
+    {
+        constrained_type<int, test_predicate, throwing_verifier> a(4);
+        REQUIRE_THROWS_AS(a.bulk_modify([](int& value) { value = -1; }), constrain_error);
+    }
+}
+
+TEST_CASE("constrained_group")
+{
+    using my_int = constrained_type<int, test_predicate, counting_verifier>;
+
+    my_int a(1);
+    my_int b(2);
+
+    auto before = counting_verifier::count;
+    {
+        auto group = group_modify(a, b);
+        before     = counting_verifier::count;
+
+        // both temporarily invalid, no verification until the end of the scope
+        group.get<0>() = -1;
+        group.get<1>() = -1;
+        REQUIRE(counting_verifier::count == before);
+
+        group.get<0>() = 10;
+        group.get<1>() = 20;
+    }
+    // one verification per object
+    REQUIRE(counting_verifier::count == before + 2);
+    REQUIRE(*a == 10);
+    REQUIRE(*b == 20);
+}
+
+TEST_CASE("sampling_verifier")
+{
+    using verifier = sampling_verifier<4>;
+    verifier::reset_violations();
+
+    SECTION("valid values are never counted")
+    {
+        for (auto i = 0; i != 16; ++i)
+            REQUIRE(verifier::verify(i, test_predicate{}) == i);
+        REQUIRE(verifier::violations() == 0u);
+    }
+    SECTION("every Nth invalid value is counted")
+    {
+        for (auto i = 0; i != 16; ++i)
+            REQUIRE(verifier::verify(-1, test_predicate{}) == -1);
+        REQUIRE(verifier::violations() == 4u);
+
+        verifier::reset_violations();
+        REQUIRE(verifier::violations() == 0u);
+    }
+    SECTION("usable with constrained_type")
+    {
+        constrained_type<int, test_predicate, verifier> a(5);
+        REQUIRE(a.get_value() == 5);
+
+        a = 7;
+        REQUIRE(a.get_value() == 7);
+    }
+}
+
+TEST_CASE("constrained_span")
+{
+    SECTION("one verification per range")
+    {
+        std::vector<int> values;
+        for (auto i = 0; i != 1000; ++i)
+            values.push_back(i);
+
+        auto before = counting_verifier::count;
+        auto span   = verify_range<counting_verifier>(values, test_predicate{});
+        REQUIRE(counting_verifier::count == before + 1);
+
+        REQUIRE(span.size() == 1000u);
+        REQUIRE(!span.empty());
+        REQUIRE(span.data() == values.data());
+        REQUIRE(span[42] == 42);
+
+        auto sum = 0;
+        for (auto value : span)
+            sum += value;
+        REQUIRE(sum == 999 * 1000 / 2);
+    }
+    SECTION("pointer and size")
+    {
+        int  array[] = {1, 2, 3};
+        auto span    = verify_range(array, 3u, test_predicate{});
+        REQUIRE(span.size() == 3u);
+        REQUIRE(span[0] == 1);
+    }
+    SECTION("throwing verifier")
+    {
+        std::vector<int> values = {1, 2, -1, 4};
+        REQUIRE_THROWS_AS(verify_range<throwing_verifier>(values, test_predicate{}),
+                          constrain_error);
+
+        values[2] = 3;
+        auto span = verify_range<throwing_verifier>(values, test_predicate{});
+        REQUIRE(span.size() == 4u);
+    }
+}
+
 TEST_CASE("constrained_ref")
 {
     using my_ref = constrained_ref<int, test_predicate, test_verifier>;
@@ -175,6 +331,28 @@ TEST_CASE("throwing_verifier")
     REQUIRE_THROWS_AS(b = static_cast<int*>(nullptr), constrain_error);
 }
 
+TEST_CASE("verifier assumptions")
+{
+    // the verifiers re-state the predicate as an optimizer assumption after checking,
+    // which must not change results or constexpr-ness
+    struct is_positive
+    {
+        constexpr bool operator()(int i) const
+        {
+            return i > 0;
+        }
+    };
+    static_assert(assertion_verifier::verify(4, is_positive{}) == 4, "");
+    static_assert(throwing_verifier::verify(4, is_positive{}) == 4, "");
+
+    // a tagged type never verifies, its "constraint" need not even be invocable
+    struct sanitized
+    {
+    };
+    tagged_type<int, sanitized> tagged(42, sanitized{});
+    REQUIRE(tagged.get_value() == 42);
+}
+
 TEST_CASE("constraints::non_null")
 {
 #ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
@@ -0,0 +1,48 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/coroutine.hpp>
+
+#if TYPE_SAFE_USE_COROUTINES
+
+#    include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+optional<int> forty_two()
+{
+    co_return 42;
+}
+
+optional<int> empty()
+{
+    co_return nullopt;
+}
+
+optional<int> add(const optional<int>& a, const optional<int>& b)
+{
+    co_return co_await a + co_await b;
+}
+} // namespace
+
+TEST_CASE("optional co_await")
+{
+    auto value = forty_two();
+    REQUIRE(value.has_value());
+    REQUIRE(value.value() == 42);
+
+    REQUIRE(!empty().has_value());
+
+    auto sum = add(4, 38);
+    REQUIRE(sum.has_value());
+    REQUIRE(sum.value() == 42);
+
+    // co_await of an empty optional short circuits
+    REQUIRE(!add(4, nullopt).has_value());
+    REQUIRE(!add(nullopt, 38).has_value());
+}
+
+#endif
@@ -63,3 +63,84 @@ TEST_CASE("deferred_construction")
         REQUIRE(a);
     }
 }
+
+namespace
+{
+struct session
+{
+    static int alive;
+
+    int id;
+
+    explicit session(int i) : id(i)
+    {
+        ++alive;
+    }
+
+    ~session()
+    {
+        --alive;
+    }
+};
+
+int session::alive;
+} // namespace
+
+TEST_CASE("deferred_pool")
+{
+    SECTION("acquire")
+    {
+        deferred_pool<int> pool(4u);
+        REQUIRE(pool.capacity() == 4u);
+        REQUIRE(pool.acquired() == 0u);
+
+        auto& a = pool.acquire();
+        REQUIRE(pool.acquired() == 1u);
+        REQUIRE(!a.has_value());
+
+        a = 42;
+        REQUIRE(a.value() == 42);
+
+        // slots are independent
+        auto& b = pool.acquire();
+        REQUIRE(!b.has_value());
+        REQUIRE(a.value() == 42);
+
+        pool.reset();
+        REQUIRE(pool.acquired() == 0u);
+        REQUIRE(pool.capacity() == 4u);
+    }
+    SECTION("lazy construction")
+    {
+        deferred_pool<session> pool(8u);
+        for (auto i = 0; i != 8; ++i)
+        {
+            auto& slot = pool.acquire();
+            if (i % 2 == 0)
+                slot.emplace(i);
+        }
+        // only the initialized slots constructed a session
+        REQUIRE(session::alive == 4);
+
+        pool.reset();
+        REQUIRE(session::alive == 0);
+
+        // slots can be handed out again
+        auto& slot = pool.acquire();
+        slot.emplace(42);
+        REQUIRE(slot.value().id == 42);
+    }
+    // the destructor resets as well
+    REQUIRE(session::alive == 0);
+
+    SECTION("move")
+    {
+        deferred_pool<std::string> pool(2u);
+        pool.acquire().emplace("abc");
+
+        deferred_pool<std::string> moved(std::move(pool));
+        REQUIRE(moved.acquired() == 1u);
+        REQUIRE(moved.capacity() == 2u);
+        REQUIRE(pool.capacity() == 0u);
+    }
+}
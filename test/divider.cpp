@@ -0,0 +1,68 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/divider.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+using namespace type_safe;
+
+namespace
+{
+template <typename T>
+void check_divisor(T d)
+{
+    divider<T> div(d);
+    REQUIRE(div.divisor() == d);
+
+    std::vector<T> numerators{T(0), T(1), T(2), T(3), T(17), T(100), d, T(d + T(1)),
+                              std::numeric_limits<T>::max(),
+                              T(std::numeric_limits<T>::max() - T(1))};
+    if (std::is_signed<T>::value)
+    {
+        numerators.push_back(T(-1));
+        numerators.push_back(T(-42));
+        numerators.push_back(T(0 - d));
+        if (d != T(-1))
+            numerators.push_back(std::numeric_limits<T>::min());
+    }
+
+    for (auto n : numerators)
+        REQUIRE(div.divide(n) == T(n / d));
+}
+} // namespace
+
+TEST_CASE("divider")
+{
+    SECTION("unsigned divisors")
+    {
+        for (auto d : {1u, 2u, 3u, 5u, 7u, 8u, 10u, 95u, 641u, 1024u, 65535u, 1u << 31,
+                       std::numeric_limits<unsigned>::max()})
+            check_divisor(d);
+    }
+    SECTION("signed divisors")
+    {
+        for (auto d : {1, -1, 2, -2, 3, -3, 7, -7, 10, 64, -64, 95, -95, 1 << 30,
+                       std::numeric_limits<int>::max(), std::numeric_limits<int>::min() + 1})
+            check_divisor(d);
+    }
+    SECTION("small and large types")
+    {
+        check_divisor(std::uint8_t(7));
+        check_divisor(std::int16_t(-123));
+        check_divisor(std::uint64_t(7919));
+        check_divisor(std::int64_t(-100000007));
+    }
+    SECTION("operator/ with ts::integer")
+    {
+        using int_t = integer<int>;
+        divider<int> seven(integer<int>(7));
+
+        REQUIRE(static_cast<int>(int_t(42) / seven) == 6);
+        REQUIRE(static_cast<int>(int_t(-43) / seven) == -6);
+        REQUIRE(100 / seven == 14);
+    }
+}
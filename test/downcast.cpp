@@ -64,3 +64,105 @@ TEST_CASE("downcast")
         REQUIRE(&res2 == &ref);
     }
 }
+
+namespace
+{
+struct shape
+{
+    enum kind_t
+    {
+        rectangle_kind,
+        circle_kind,
+    } my_kind;
+
+    explicit shape(kind_t k) : my_kind(k) {}
+};
+
+struct rectangle : shape
+{
+    rectangle() : shape(rectangle_kind) {}
+};
+
+struct circle : shape
+{
+    circle() : shape(circle_kind) {}
+};
+} // namespace
+
+namespace type_safe
+{
+template <>
+struct known_derived_types<shape> : derived_kinds<rectangle, circle>
+{
+    static std::size_t kind(const shape& obj)
+    {
+        return std::size_t(obj.my_kind);
+    }
+};
+} // namespace type_safe
+
+TEST_CASE("downcast known_derived_types")
+{
+    rectangle r;
+    circle    c;
+
+    // verified by comparing the stored kind, no RTTI involved
+    shape& ref1 = r;
+    auto&  res1 = downcast(derived_type<rectangle>{}, ref1);
+    REQUIRE(&res1 == &r);
+
+    const shape& ref2 = c;
+    auto&        res2 = downcast<const circle&>(ref2);
+    REQUIRE(&res2 == &c);
+}
+
+TEST_CASE("downcast final")
+{
+    struct base
+    {
+        virtual ~base() = default;
+    };
+
+    struct derived final : base
+    {
+        ~derived() override = default;
+    };
+
+    derived d;
+    base&   ref = d;
+
+    // verified by an exact type comparison
+    derived& res = downcast<derived&>(ref);
+    REQUIRE(&res == &d);
+}
+
+TEST_CASE("downcast_batch")
+{
+    rectangle rects[3];
+    shape*    ptrs[] = {&rects[0], &rects[1], &rects[2]};
+
+    SECTION("mutable")
+    {
+        auto count = 0;
+        downcast_batch<rectangle>(ptrs, 3u, [&](rectangle& rect) {
+            REQUIRE(&rect == &rects[count]);
+            ++count;
+        });
+        REQUIRE(count == 3);
+    }
+    SECTION("const")
+    {
+        const shape* const* cptrs = ptrs;
+
+        auto count = 0;
+        downcast_batch<rectangle>(cptrs, 3u, [&](const rectangle& rect) {
+            REQUIRE(&rect == &rects[count]);
+            ++count;
+        });
+        REQUIRE(count == 3);
+    }
+    SECTION("empty")
+    {
+        downcast_batch<rectangle>(ptrs, 0u, [&](rectangle&) { REQUIRE(false); });
+    }
+}
@@ -6,6 +6,9 @@
 
 #include <catch.hpp>
 
+#include <thread>
+#include <vector>
+
 using namespace type_safe;
 
 TEST_CASE("flag")
@@ -79,3 +82,92 @@ TEST_CASE("flag")
         REQUIRE(b == false);
     }
 }
+
+TEST_CASE("atomic_flag_t")
+{
+    SECTION("constructor")
+    {
+        atomic_flag_t a(true);
+        REQUIRE(a.load());
+
+        atomic_flag_t b(false);
+        REQUIRE(!b.load());
+    }
+    SECTION("toggle")
+    {
+        atomic_flag_t a(true);
+        REQUIRE(a.toggle());
+        REQUIRE(!a.load());
+
+        atomic_flag_t b(false);
+        REQUIRE(!b.toggle());
+        REQUIRE(b.load());
+    }
+    SECTION("change")
+    {
+        atomic_flag_t a(true);
+        a.change(false);
+        REQUIRE(!a.load());
+
+        atomic_flag_t b(false);
+        b.change(true);
+        REQUIRE(b.load());
+    }
+    SECTION("set")
+    {
+        atomic_flag_t a(true);
+        a.set();
+        REQUIRE(a.load());
+
+        atomic_flag_t b(false);
+        b.set();
+        REQUIRE(b.load());
+    }
+    SECTION("try_set")
+    {
+        atomic_flag_t a(true);
+        REQUIRE(!a.try_set());
+        REQUIRE(a.load());
+
+        atomic_flag_t b(false);
+        REQUIRE(b.try_set());
+        REQUIRE(b.load());
+    }
+    SECTION("reset")
+    {
+        atomic_flag_t a(true);
+        a.reset();
+        REQUIRE(!a.load());
+
+        atomic_flag_t b(false);
+        b.reset();
+        REQUIRE(!b.load());
+    }
+    SECTION("try_reset")
+    {
+        atomic_flag_t a(true);
+        REQUIRE(a.try_reset());
+        REQUIRE(!a.load());
+
+        atomic_flag_t b(false);
+        REQUIRE(!b.try_reset());
+        REQUIRE(!b.load());
+    }
+    SECTION("one writer wins")
+    {
+        atomic_flag_t guard(false);
+
+        std::vector<std::thread> threads;
+        std::atomic<int>         winners(0);
+        for (auto i = 0; i != 4; ++i)
+            threads.emplace_back([&] {
+                if (guard.try_set(std::memory_order_acq_rel))
+                    ++winners;
+            });
+        for (auto& t : threads)
+            t.join();
+
+        REQUIRE(winners == 1);
+        REQUIRE(guard.load());
+    }
+}
@@ -238,3 +238,213 @@ TEST_CASE("flag_set")
         check_set(s, true, false, false);
     }
 }
+
+TEST_CASE("flag_set iteration")
+{
+    type_safe::flag_set<test_flags> s;
+
+    SECTION("empty")
+    {
+        REQUIRE(s.begin() == s.end());
+
+        s.for_each_set([](test_flags) { REQUIRE(false); });
+    }
+    SECTION("iterator")
+    {
+        s = test_flags::a | test_flags::c;
+
+        auto iter = s.begin();
+        REQUIRE(iter != s.end());
+        REQUIRE(*iter == test_flags::a);
+
+        ++iter;
+        REQUIRE(iter != s.end());
+        REQUIRE(*iter == test_flags::c);
+
+        REQUIRE(++iter == s.end());
+    }
+    SECTION("for_each_set")
+    {
+        s.set_all();
+
+        int  count = 0;
+        auto next  = test_flags::a;
+        s.for_each_set([&](test_flags f) {
+            // visited in order of increasing bit index
+            REQUIRE(f == next);
+            next = test_flags(int(next) + 1);
+            ++count;
+        });
+        REQUIRE(count == 3);
+    }
+    SECTION("range for")
+    {
+        s = test_flags::b | test_flags::c;
+
+        int count = 0;
+        for (auto f : s)
+        {
+            REQUIRE(s.is_set(f));
+            ++count;
+        }
+        REQUIRE(count == 2);
+    }
+}
+
+TEST_CASE("atomic_flag_set")
+{
+    type_safe::atomic_flag_set<test_flags> s;
+    check_set(s.load(), false, false, false);
+
+    SECTION("set/reset/toggle")
+    {
+        s.set(test_flags::a);
+        check_set(s.load(), true, false, false);
+
+        s.set(test_flags::b, true);
+        check_set(s.load(), true, true, false);
+
+        s.set(test_flags::a, false);
+        check_set(s.load(), false, true, false);
+
+        s.reset(test_flags::b);
+        check_set(s.load(), false, false, false);
+
+        s.toggle(test_flags::c);
+        check_set(s.load(), false, false, true);
+
+        s.toggle_all();
+        check_set(s.load(), true, true, false);
+
+        s.reset_all();
+        check_set(s.load(), false, false, false);
+
+        s.set_all();
+        check_set(s.load(), true, true, true);
+        REQUIRE(s.is_set(test_flags::a));
+        REQUIRE(s.as_flag(test_flags::b) == true);
+    }
+    SECTION("binary op")
+    {
+        s |= test_flags::a | test_flags::b;
+        check_set(s.load(), true, true, false);
+
+        s &= ~test_flags::a;
+        check_set(s.load(), false, true, false);
+
+        s ^= test_flags::b | test_flags::c;
+        check_set(s.load(), false, false, true);
+    }
+    SECTION("store/exchange")
+    {
+        s.store(type_safe::flag_set<test_flags>(test_flags::a | test_flags::c));
+        check_set(s.load(), true, false, true);
+
+        auto old = s.exchange(type_safe::flag_set<test_flags>(test_flags::b));
+        check_set(old, true, false, true);
+        check_set(s.load(), false, true, false);
+    }
+    SECTION("try_transition")
+    {
+        s.set(test_flags::a);
+
+        // expected state does not match, expected is updated
+        type_safe::flag_set<test_flags> expected(test_flags::b);
+        REQUIRE(!s.try_transition(expected, type_safe::flag_set<test_flags>(test_flags::c)));
+        check_set(expected, true, false, false);
+        check_set(s.load(), true, false, false);
+
+        // expected state matches, transition happens
+        REQUIRE(s.try_transition(expected, type_safe::flag_set<test_flags>(test_flags::c)));
+        check_set(s.load(), false, false, true);
+    }
+}
+
+enum class big_flags
+{
+    first          = 0,
+    bit_63         = 63,
+    bit_64         = 64,
+    last           = 179,
+    _flag_set_size = 180,
+};
+
+TEST_CASE("flag_set multi word")
+{
+    using set_t = type_safe::flag_set<big_flags>;
+    static_assert(sizeof(set_t) == 3 * sizeof(std::uint64_t), "180 flags need three words");
+
+    SECTION("set/reset/toggle across words")
+    {
+        set_t s;
+        REQUIRE(s.none());
+
+        s.set(big_flags::first);
+        s.set(big_flags::bit_63);
+        s.set(big_flags::bit_64);
+        s.set(big_flags::last);
+        REQUIRE(s.is_set(big_flags::first));
+        REQUIRE(s.is_set(big_flags::bit_63));
+        REQUIRE(s.is_set(big_flags::bit_64));
+        REQUIRE(s.is_set(big_flags::last));
+        REQUIRE(!s.is_set(static_cast<big_flags>(100)));
+        REQUIRE(s.any());
+
+        s.reset(big_flags::bit_63);
+        REQUIRE(!s.is_set(big_flags::bit_63));
+
+        s.toggle(big_flags::bit_64);
+        REQUIRE(!s.is_set(big_flags::bit_64));
+        s.toggle(big_flags::bit_64);
+        REQUIRE(s.is_set(big_flags::bit_64));
+    }
+    SECTION("all/none")
+    {
+        set_t s;
+        s.set_all();
+        REQUIRE(s.all());
+        for (auto i = 0; i != 180; ++i)
+            REQUIRE(s.is_set(static_cast<big_flags>(i)));
+
+        s.toggle_all();
+        REQUIRE(s.none());
+
+        s.set(big_flags::last);
+        REQUIRE(!s.all());
+        REQUIRE(!s.none());
+    }
+    SECTION("bitwise operators")
+    {
+        set_t a(big_flags::first | big_flags::bit_64);
+        set_t b = a | big_flags::last;
+        REQUIRE(b.is_set(big_flags::first));
+        REQUIRE(b.is_set(big_flags::bit_64));
+        REQUIRE(b.is_set(big_flags::last));
+        REQUIRE(a != b);
+
+        b &= type_safe::mask(big_flags::first | big_flags::last);
+        REQUIRE(b.is_set(big_flags::first));
+        REQUIRE(!b.is_set(big_flags::bit_64));
+        REQUIRE(b.is_set(big_flags::last));
+
+        REQUIRE((b & big_flags::last));
+        REQUIRE(!(b & big_flags::bit_63));
+
+        auto inverted = ~b;
+        REQUIRE(!inverted.is_set(big_flags::first));
+        REQUIRE(inverted.is_set(big_flags::bit_63));
+    }
+    SECTION("iteration")
+    {
+        set_t s;
+        s.set(big_flags::bit_63);
+        s.set(big_flags::bit_64);
+        s.set(big_flags::last);
+
+        std::size_t expected[] = {63u, 64u, 179u};
+        std::size_t index      = 0u;
+        for (auto flag : s)
+            REQUIRE(static_cast<std::size_t>(flag) == expected[index++]);
+        REQUIRE(index == 3u);
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/flag_set_column.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+// no using namespace to test operator namespace
+
+enum class row_flags
+{
+    dirty,
+    cached,
+    pinned,
+    _flag_set_size
+};
+
+TEST_CASE("flag_set_column")
+{
+    type_safe::flag_set_column<row_flags> column;
+    REQUIRE(column.empty());
+    REQUIRE(column.size() == 0u);
+
+    SECTION("push_back/flag operation")
+    {
+        column.push_back(row_flags::dirty | row_flags::pinned);
+        column.push_back(type_safe::noflag);
+        column.push_back(type_safe::flag_set<row_flags>(row_flags::cached));
+        REQUIRE(column.size() == 3u);
+
+        REQUIRE(column.is_set(0u, row_flags::dirty));
+        REQUIRE(!column.is_set(0u, row_flags::cached));
+        REQUIRE(column.is_set(0u, row_flags::pinned));
+        REQUIRE(column[1u] == type_safe::noflag);
+        REQUIRE(column[2u] == row_flags::cached);
+
+        column.set(1u, row_flags::dirty);
+        REQUIRE(column.is_set(1u, row_flags::dirty));
+
+        column.set(1u, row_flags::dirty, false);
+        REQUIRE(!column.is_set(1u, row_flags::dirty));
+
+        column.toggle(1u, row_flags::cached);
+        REQUIRE(column.is_set(1u, row_flags::cached));
+
+        column.reset(1u, row_flags::cached);
+        REQUIRE(column[1u] == type_safe::noflag);
+
+        column.pop_back();
+        REQUIRE(column.size() == 2u);
+
+        column.clear();
+        REQUIRE(column.empty());
+    }
+    SECTION("count/for_each_row")
+    {
+        // more rows than bits in a word
+        column.reserve(100u);
+        for (auto i = 0u; i != 100u; ++i)
+            if (i % 3u == 0u)
+                column.push_back(row_flags::dirty | row_flags::cached);
+            else
+                column.push_back(type_safe::flag_set<row_flags>(row_flags::cached));
+
+        REQUIRE(column.count(row_flags::dirty) == 34u);
+        REQUIRE(column.count(row_flags::cached) == 100u);
+        REQUIRE(column.count(row_flags::pinned) == 0u);
+
+        std::vector<std::size_t> rows;
+        column.for_each_row(row_flags::dirty, [&](std::size_t row) { rows.push_back(row); });
+        REQUIRE(rows.size() == 34u);
+        for (auto row : rows)
+            REQUIRE(row % 3u == 0u);
+    }
+    SECTION("row_mask")
+    {
+        column.push_back(row_flags::dirty | row_flags::cached);
+        column.push_back(type_safe::flag_set<row_flags>(row_flags::dirty));
+        column.push_back(type_safe::flag_set<row_flags>(row_flags::cached));
+        column.push_back(type_safe::noflag);
+
+        auto dirty  = column.column(row_flags::dirty);
+        auto cached = column.column(row_flags::cached);
+
+        auto both = dirty & cached;
+        REQUIRE(both.count() == 1u);
+        REQUIRE(both.is_set(0u));
+
+        auto either = dirty | cached;
+        REQUIRE(either.count() == 3u);
+        REQUIRE(!either.is_set(3u));
+
+        auto dirty_only = dirty.and_not(cached);
+        REQUIRE(dirty_only.count() == 1u);
+        REQUIRE(dirty_only.is_set(1u));
+
+        std::vector<std::size_t> rows;
+        either.for_each_row([&](std::size_t row) { rows.push_back(row); });
+        REQUIRE(rows == std::vector<std::size_t>{0u, 1u, 2u});
+    }
+}
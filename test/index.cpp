@@ -6,8 +6,13 @@
 
 #include <catch.hpp>
 
+#include <iterator>
+#include <type_traits>
+
+using type_safe::checked_view;
 using type_safe::difference_t;
 using type_safe::index_t;
+using type_safe::make_checked_view;
 
 TEST_CASE("index_t")
 {
@@ -104,3 +109,83 @@ TEST_CASE("index_t")
             REQUIRE(at(array, i) == std::size_t(get(i)));
     }
 }
+
+TEST_CASE("checked_view")
+{
+    std::size_t array[] = {0, 1, 2, 3, 4, 5};
+
+    SECTION("full view")
+    {
+        checked_view<std::size_t[6]> view(array, index_t(0u), index_t(6u));
+        REQUIRE(!view.empty());
+        REQUIRE(view.size() == difference_t(6));
+        REQUIRE(view.begin_index() == index_t(0u));
+        REQUIRE(view.end_index() == index_t(6u));
+
+        for (auto i = view.begin_index(); i != view.end_index(); ++i)
+            REQUIRE(view[i] == std::size_t(get(i)));
+    }
+    SECTION("window")
+    {
+        auto view = make_checked_view(array, index_t(2u), index_t(5u));
+        REQUIRE(view.size() == difference_t(3));
+
+        view[index_t(2u)] = 42u;
+        REQUIRE(array[2] == 42u);
+    }
+    SECTION("iterator")
+    {
+        auto view = make_checked_view(array, index_t(1u), index_t(5u));
+
+        auto iter = view.begin();
+        REQUIRE(iter.index() == index_t(1u));
+        REQUIRE(*iter == 1u);
+
+        ++iter;
+        REQUIRE(*iter == 2u);
+
+        iter += difference_t(2);
+        REQUIRE(*iter == 4u);
+        REQUIRE(iter[difference_t(-1)] == 3u);
+
+        REQUIRE(iter - view.begin() == difference_t(3));
+        REQUIRE(view.begin() < iter);
+
+        --iter;
+        iter = iter - difference_t(2);
+        REQUIRE(iter == view.begin());
+
+        auto sum = 0u;
+        for (auto element : view)
+            sum += unsigned(element);
+        REQUIRE(sum == 1u + 2u + 3u + 4u);
+
+        std::advance(iter, 4);
+        REQUIRE(iter == view.end());
+    }
+    SECTION("empty window")
+    {
+        auto view = make_checked_view(array, index_t(6u), index_t(6u));
+        REQUIRE(view.empty());
+        REQUIRE(view.begin() == view.end());
+    }
+}
+
+TEST_CASE("index literals")
+{
+    using namespace type_safe::literals;
+
+    auto idx = 42_idx;
+    static_assert(std::is_same<decltype(idx), index_t>::value, "");
+    REQUIRE(idx == index_t(42u));
+
+    auto dist = -3_dist;
+    static_assert(std::is_same<decltype(dist), difference_t>::value, "");
+    REQUIRE(dist == difference_t(-3));
+
+    REQUIRE(40_idx + 2_dist == 42_idx);
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+    static_assert(get(42_idx) == 42u, "literal must be a constant expression");
+#endif
+}
@@ -574,3 +574,111 @@ TEST_CASE("integer")
         REQUIRE(std::is_convertible<integer<uint64_t>, integer<uint64_t>>::value);
     }
 }
+
+TEST_CASE("integer try arithmetic")
+{
+    using int_t = integer<int>;
+    auto  max   = std::numeric_limits<int>::max();
+    auto  min   = std::numeric_limits<int>::min();
+
+    SECTION("try_add")
+    {
+        auto a = try_add(int_t(4), int_t(5));
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == 9);
+
+        auto b = try_add(int_t(max), int_t(1));
+        REQUIRE(!static_cast<bool>(b));
+        REQUIRE(static_cast<int>(b.value_or(int_t(-1))) == -1);
+    }
+    SECTION("try_sub")
+    {
+        auto a = try_sub(int_t(4), int_t(5));
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == -1);
+
+        auto b = try_sub(int_t(min), int_t(1));
+        REQUIRE(!static_cast<bool>(b));
+    }
+    SECTION("try_mul")
+    {
+        auto a = try_mul(int_t(4), int_t(5));
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == 20);
+
+        auto b = try_mul(int_t(max), int_t(2));
+        REQUIRE(!static_cast<bool>(b));
+    }
+    SECTION("try_div")
+    {
+        auto a = try_div(int_t(20), int_t(5));
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == 4);
+
+        auto b = try_div(int_t(20), int_t(0));
+        REQUIRE(!static_cast<bool>(b));
+    }
+    SECTION("try_mod")
+    {
+        auto a = try_mod(int_t(21), int_t(5));
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == 1);
+
+        auto b = try_mod(int_t(21), int_t(0));
+        REQUIRE(!static_cast<bool>(b));
+    }
+    SECTION("mixed size")
+    {
+        auto a = try_add(integer<short>(short(1)), int_t(2));
+        static_assert(std::is_same<decltype(a.value()), int_t>::value, "");
+        REQUIRE(static_cast<bool>(a));
+        REQUIRE(static_cast<int>(a.value()) == 3);
+    }
+}
+
+TEST_CASE("integer bit operations")
+{
+    using uint_t = integer<std::uint32_t>;
+
+    SECTION("popcount")
+    {
+        REQUIRE(static_cast<unsigned>(popcount(uint_t(0u))) == 0u);
+        REQUIRE(static_cast<unsigned>(popcount(uint_t(1u))) == 1u);
+        REQUIRE(static_cast<unsigned>(popcount(uint_t(0xF0F0u))) == 8u);
+        REQUIRE(static_cast<unsigned>(popcount(uint_t(0xFFFFFFFFu))) == 32u);
+        REQUIRE(static_cast<unsigned>(popcount(integer<std::uint64_t>(~std::uint64_t(0)))) == 64u);
+    }
+    SECTION("countl_zero")
+    {
+        REQUIRE(static_cast<unsigned>(countl_zero(uint_t(0u))) == 32u);
+        REQUIRE(static_cast<unsigned>(countl_zero(uint_t(1u))) == 31u);
+        REQUIRE(static_cast<unsigned>(countl_zero(uint_t(0x80000000u))) == 0u);
+        REQUIRE(static_cast<unsigned>(countl_zero(integer<std::uint8_t>(std::uint8_t(0x10)))) == 3u);
+    }
+    SECTION("countr_zero")
+    {
+        REQUIRE(static_cast<unsigned>(countr_zero(uint_t(0u))) == 32u);
+        REQUIRE(static_cast<unsigned>(countr_zero(uint_t(1u))) == 0u);
+        REQUIRE(static_cast<unsigned>(countr_zero(uint_t(0x80000000u))) == 31u);
+        REQUIRE(static_cast<unsigned>(countr_zero(uint_t(8u))) == 3u);
+    }
+    SECTION("rotl/rotr")
+    {
+        REQUIRE(static_cast<std::uint32_t>(rotl(uint_t(0x80000001u), 1)) == 0x3u);
+        REQUIRE(static_cast<std::uint32_t>(rotl(uint_t(0x12345678u), 0)) == 0x12345678u);
+        REQUIRE(static_cast<std::uint32_t>(rotl(uint_t(0x12345678u), 32)) == 0x12345678u);
+        REQUIRE(static_cast<std::uint32_t>(rotr(uint_t(0x3u), 1)) == 0x80000001u);
+        REQUIRE(static_cast<std::uint32_t>(rotl(uint_t(0x3u), -1)) == 0x80000001u);
+    }
+    SECTION("byteswap")
+    {
+        REQUIRE(static_cast<std::uint32_t>(byteswap(uint_t(0x12345678u))) == 0x78563412u);
+        REQUIRE(static_cast<std::uint16_t>(byteswap(integer<std::uint16_t>(std::uint16_t(0x1234))))
+                == 0x3412u);
+        REQUIRE(static_cast<std::uint64_t>(
+                    byteswap(integer<std::uint64_t>(std::uint64_t(0x0102030405060708ull))))
+                == 0x0807060504030201ull);
+        REQUIRE(static_cast<std::uint8_t>(byteswap(integer<std::uint8_t>(std::uint8_t(0xAB))))
+                == 0xABu);
+    }
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/math.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+TEST_CASE("math")
+{
+    using float_t = floating_point<double>;
+
+    SECTION("unary")
+    {
+        REQUIRE(static_cast<double>(type_safe::abs(float_t(-2.))) == 2.);
+        REQUIRE(static_cast<double>(type_safe::sqrt(float_t(4.))) == 2.);
+        REQUIRE(static_cast<double>(type_safe::floor(float_t(2.5))) == 2.);
+        REQUIRE(static_cast<double>(type_safe::ceil(float_t(2.5))) == 3.);
+        REQUIRE(static_cast<double>(type_safe::trunc(float_t(-2.5))) == -2.);
+        REQUIRE(static_cast<double>(type_safe::round(float_t(2.5))) == 3.);
+        REQUIRE(static_cast<double>(type_safe::exp(float_t(0.))) == 1.);
+        REQUIRE(static_cast<double>(type_safe::log(float_t(1.))) == 0.);
+    }
+    SECTION("binary")
+    {
+        REQUIRE(static_cast<double>(type_safe::pow(float_t(2.), float_t(10.))) == 1024.);
+        REQUIRE(static_cast<double>(type_safe::min(float_t(1.), float_t(2.))) == 1.);
+        REQUIRE(static_cast<double>(type_safe::max(float_t(1.), float_t(2.))) == 2.);
+        REQUIRE(static_cast<double>(type_safe::copysign(float_t(2.), float_t(-1.))) == -2.);
+        REQUIRE(static_cast<double>(type_safe::fmod(float_t(7.), float_t(2.))) == 1.);
+    }
+    SECTION("fma")
+    {
+        REQUIRE(static_cast<double>(type_safe::fma(float_t(2.), float_t(3.), float_t(4.))) == 10.);
+    }
+}
@@ -32,3 +32,40 @@ TEST_CASE("narrow_cast<floating_point>")
     floating_point<float> c = narrow_cast<floating_point<float>>(a);
     REQUIRE(static_cast<float>(c) == 1.);
 }
+
+TEST_CASE("round_cast")
+{
+    SECTION("rounding modes")
+    {
+        REQUIRE(round_cast<int>(2.5, round_nearest) == 2); // ties to even
+        REQUIRE(round_cast<int>(2.6, round_nearest) == 3);
+        REQUIRE(round_cast<int>(-2.6, round_nearest) == -3);
+
+        REQUIRE(round_cast<int>(2.9, round_floor) == 2);
+        REQUIRE(round_cast<int>(-2.1, round_floor) == -3);
+
+        REQUIRE(round_cast<int>(2.1, round_ceil) == 3);
+        REQUIRE(round_cast<int>(-2.9, round_ceil) == -2);
+
+        REQUIRE(round_cast<int>(2.9, round_truncate) == 2);
+        REQUIRE(round_cast<int>(-2.9, round_truncate) == -2);
+    }
+    SECTION("wrapped types")
+    {
+        floating_point<double> quantized(3.7);
+
+        integer<int> a = round_cast<int>(quantized, round_nearest);
+        REQUIRE(static_cast<int>(a) == 4);
+
+        integer<short> b = round_cast<integer<short>>(quantized, round_floor);
+        REQUIRE(static_cast<short>(b) == 3);
+    }
+    SECTION("boundary values fit")
+    {
+        // the exact bounds are still representable
+        REQUIRE(round_cast<int>(2147483647.0, round_truncate) == 2147483647);
+        REQUIRE(round_cast<int>(-2147483648.0, round_truncate) == -2147483647 - 1);
+        REQUIRE(round_cast<unsigned char>(255.4, round_nearest) == 255u);
+        REQUIRE(round_cast<unsigned char>(0.4, round_floor) == 0u);
+    }
+}
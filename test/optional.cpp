@@ -14,6 +14,13 @@ using type_safe::optional_ref;
 using type_safe::make_optional;
 using type_safe::nullopt;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(std::is_trivially_copyable<optional<int>>::value, "");
+static_assert(std::is_trivially_destructible<optional<int>>::value, "");
+static_assert(!std::is_trivially_copyable<optional<debugger_type>>::value, "");
+static_assert(!std::is_trivially_destructible<optional<debugger_type>>::value, "");
+#endif
+
 TEST_CASE("optional")
 {
     SECTION("constructor - empty")
@@ -260,6 +267,23 @@ TEST_CASE("optional")
         REQUIRE(f.value().ctor());
         REQUIRE(f.value().move_assigned());
     }
+    SECTION("emplace_result")
+    {
+        optional<debugger_type> a;
+        a.emplace_result([] { return debugger_type(1); });
+        REQUIRE(a.has_value());
+        REQUIRE(a.value().id == 1);
+        // the factory result was constructed directly in the storage
+        REQUIRE(a.value().ctor());
+        REQUIRE(a.value().not_assigned());
+
+        optional<debugger_type> b(0);
+        b.emplace_result([] { return debugger_type(1); });
+        REQUIRE(b.has_value());
+        REQUIRE(b.value().id == 1);
+        REQUIRE(b.value().ctor());
+        REQUIRE(b.value().not_assigned());
+    }
     SECTION("operator bool")
     {
         optional<int> a;
@@ -290,6 +314,26 @@ TEST_CASE("optional")
         auto                    b_res = b.value_or(1);
         REQUIRE(b_res.id == 0);
     }
+    SECTION("value_or_eval")
+    {
+        auto invoked = false;
+        auto factory = [&] {
+            invoked = true;
+            return debugger_type(1);
+        };
+
+        optional<debugger_type> a;
+        auto                    a_res = a.value_or_eval(factory);
+        REQUIRE(a_res.id == 1);
+        REQUIRE(invoked);
+
+        invoked = false;
+        optional<debugger_type> b(0);
+        auto                    b_res = b.value_or_eval(factory);
+        REQUIRE(b_res.id == 0);
+        // the fallback is lazy, the factory must not run when there is a value
+        REQUIRE_FALSE(invoked);
+    }
     SECTION("map")
     {
         auto func = [](int i) { return "abc"[i]; };
@@ -344,6 +388,70 @@ TEST_CASE("optional")
         });
 #endif
     }
+    SECTION("pipe")
+    {
+        auto parse    = [](int i) { return "abc"[i]; };
+        auto validate = [](char c) { return c != 'b'; };
+
+        optional<int> a;
+        optional<char> a_res = a.pipe(parse);
+        REQUIRE_FALSE(a_res.has_value());
+
+        optional<bool> a_res2 = a.pipe(parse, validate);
+        REQUIRE_FALSE(a_res2.has_value());
+
+        optional<int> b(0);
+        optional<char> b_res = b.pipe(parse);
+        REQUIRE(b_res.has_value());
+        REQUIRE(b_res.value() == 'a');
+
+        optional<bool> b_res2 = b.pipe(parse, validate);
+        REQUIRE(b_res2.has_value());
+        REQUIRE(b_res2.value());
+
+        optional<int> c(1);
+        optional<bool> c_res = c.pipe(parse, validate);
+        REQUIRE(c_res.has_value());
+        REQUIRE_FALSE(c_res.value());
+
+        struct foo
+        {
+            int var = 42;
+        };
+
+        optional<foo> d(foo{});
+        optional<char> d_res = d.pipe(&foo::var, [](int i) { return char('a' + i - 42); });
+        REQUIRE(d_res.has_value());
+        REQUIRE(d_res.value() == 'a');
+    }
+    SECTION("map_in_place")
+    {
+        auto twice = [](int i) { return 2 * i; };
+
+        optional<int> a;
+        a.map_in_place(twice);
+        REQUIRE_FALSE(a.has_value());
+
+        optional<int> b(2);
+        b.map_in_place(twice).map_in_place(twice);
+        REQUIRE(b.has_value());
+        REQUIRE(b.value() == 8);
+
+        struct foo
+        {
+            int var;
+
+            foo add(int i) const
+            {
+                return foo{var + i};
+            }
+        };
+
+        optional<foo> c(foo{1});
+        c.map_in_place(&foo::add, 2);
+        REQUIRE(c.has_value());
+        REQUIRE(c.value().var == 3);
+    }
     SECTION("with")
     {
         optional<int> a;
@@ -476,3 +584,34 @@ TEST_CASE("optional")
         REQUIRE(b.value() == "a");
     }
 }
+
+#if TYPE_SAFE_USE_CONSTEXPR20
+namespace
+{
+// a lookup table built entirely at compile time, lives in rodata
+constexpr optional<int> constexpr_table[] = {nullopt, 1, 2, nullopt};
+
+constexpr int constexpr_roundtrip()
+{
+    optional<int> opt;
+    opt.emplace(40);
+    auto copy = opt;
+    copy.value() += 2;
+    copy.reset();
+    return opt.value() + copy.value_or(2);
+}
+} // namespace
+
+TEST_CASE("optional constexpr")
+{
+    static_assert(!constexpr_table[0].has_value());
+    static_assert(constexpr_table[1].value() == 1);
+    static_assert(constexpr_table[2] == 2);
+    static_assert(constexpr_roundtrip() == 42);
+    static_assert(make_optional(1) < make_optional(2));
+
+    // the same table is usable at runtime
+    REQUIRE(constexpr_table[1].value() == 1);
+    REQUIRE(constexpr_table[3] == nullopt);
+}
+#endif
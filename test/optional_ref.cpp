@@ -15,7 +15,10 @@ using type_safe::optional_xvalue_ref;
 using type_safe::opt_ref;
 using type_safe::opt_cref;
 using type_safe::opt_xref;
+using type_safe::optional_offset_ref;
+using type_safe::opt_offset_ref;
 using type_safe::ref;
+using type_safe::set_offset_base;
 
 template <typename A, typename B, typename Value>
 void test_optional_ref_conversion(Value)
@@ -230,3 +233,60 @@ TEST_CASE("optional_xvalue_ref")
 #endif
     }
 }
+
+namespace
+{
+struct node_arena
+{};
+} // namespace
+
+TEST_CASE("optional_offset_ref")
+{
+    int arena[64] = {};
+    set_offset_base<node_arena>(arena);
+
+    using ref_t = optional_offset_ref<int, node_arena>;
+    static_assert(sizeof(ref_t) == sizeof(std::uint32_t), "must be offset sized");
+
+    SECTION("null")
+    {
+        ref_t ref;
+        REQUIRE_FALSE(ref.has_value());
+        REQUIRE(ref.value_or(arena[0]) == 0);
+    }
+    SECTION("binding")
+    {
+        arena[42] = 11;
+
+        auto ref = opt_offset_ref<node_arena>(&arena[42]);
+        REQUIRE(ref.has_value());
+        REQUIRE(ref.value() == 11);
+
+        ref.value() = 7;
+        REQUIRE(arena[42] == 7);
+
+        auto null = opt_offset_ref<node_arena>(static_cast<int*>(nullptr));
+        REQUIRE_FALSE(null.has_value());
+    }
+    SECTION("interface parity")
+    {
+        arena[1] = 3;
+        ref_t ref(arena[1]);
+
+        // maps like optional_ref does, rebinding to an optional_ref
+        auto mapped = ref.map([](int& i) -> int& { return i; });
+        static_assert(std::is_same<decltype(mapped), optional_ref<int>>::value, "");
+        REQUIRE(mapped.has_value());
+        REQUIRE(mapped.value() == 3);
+
+        REQUIRE(ref.value_or(arena[0]) == 3);
+
+        ref_t other(arena[2]);
+        swap(ref, other);
+        REQUIRE(ref.value() == arena[2]);
+        REQUIRE(other.value() == 3);
+
+        ref.reset();
+        REQUIRE_FALSE(ref.has_value());
+    }
+}
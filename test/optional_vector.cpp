@@ -0,0 +1,101 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/optional_vector.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+TEST_CASE("optional_vector")
+{
+    optional_vector<int> vec;
+    REQUIRE(vec.empty());
+    REQUIRE(vec.size() == 0u);
+    REQUIRE(vec.count() == 0u);
+
+    SECTION("push_back/subscript")
+    {
+        vec.push_back(1);
+        vec.push_back(nullopt);
+        vec.push_back(3);
+
+        REQUIRE(vec.size() == 3u);
+        REQUIRE(vec.count() == 2u);
+
+        REQUIRE(vec[0u].has_value());
+        REQUIRE(vec[0u].value() == 1);
+        REQUIRE(!vec[1u].has_value());
+        REQUIRE(vec[2u].has_value());
+        REQUIRE(vec[2u].value() == 3);
+
+        vec[0u].value() = 11;
+        REQUIRE(vec[0u].value() == 11);
+
+        const auto& cvec = vec;
+        REQUIRE(cvec[2u].value() == 3);
+    }
+    SECTION("pop_back")
+    {
+        vec.push_back(1);
+        vec.push_back(2);
+        vec.pop_back();
+
+        REQUIRE(vec.size() == 1u);
+        REQUIRE(vec.count() == 1u);
+
+        // the bit of the popped element must be cleared
+        vec.push_back(nullopt);
+        REQUIRE(!vec[1u].has_value());
+        REQUIRE(vec.count() == 1u);
+    }
+    SECTION("emplace/reset")
+    {
+        vec.push_back(nullopt);
+        vec.push_back(2);
+
+        vec.emplace(0u, 1);
+        REQUIRE(vec[0u].has_value());
+        REQUIRE(vec[0u].value() == 1);
+        REQUIRE(vec.count() == 2u);
+
+        vec.reset(1u);
+        REQUIRE(!vec[1u].has_value());
+        REQUIRE(vec.count() == 1u);
+    }
+    SECTION("bulk operations")
+    {
+        // more than one bitmap word
+        for (auto i = 0; i != 100; ++i)
+            if (i % 3 == 0)
+                vec.push_back(i);
+            else
+                vec.push_back(nullopt);
+
+        REQUIRE(vec.size() == 100u);
+        REQUIRE(vec.count() == 34u);
+
+        auto sum = 0;
+        vec.for_each_present([&](int i) { sum += i; });
+        REQUIRE(sum == 1683); // 0 + 3 + ... + 99
+
+        vec.for_each_present([](int& i) { i += 1; });
+        REQUIRE(vec[0u].value() == 1);
+        REQUIRE(vec[99u].value() == 100);
+
+        int out[100] = {};
+        vec.value_or(-1, ref(out));
+        REQUIRE(out[0] == 1);
+        REQUIRE(out[1] == -1);
+        REQUIRE(out[99] == 100);
+    }
+    SECTION("clear/reserve")
+    {
+        vec.reserve(100u);
+        vec.push_back(1);
+        vec.clear();
+        REQUIRE(vec.empty());
+        REQUIRE(vec.count() == 0u);
+    }
+}
@@ -9,6 +9,33 @@
 
 using namespace type_safe;
 
+namespace
+{
+struct tracked
+{
+    static int alive;
+
+    int value;
+
+    explicit tracked(int v) : value(v)
+    {
+        ++alive;
+    }
+
+    tracked(const tracked& other) : value(other.value)
+    {
+        ++alive;
+    }
+
+    ~tracked()
+    {
+        --alive;
+    }
+};
+
+int tracked::alive;
+} // namespace
+
 TEST_CASE("output_parameter")
 {
     SECTION("reference")
@@ -79,3 +106,60 @@ TEST_CASE("output_parameter")
         }
     }
 }
+
+TEST_CASE("output_buffer")
+{
+    alignas(tracked) unsigned char storage[4 * sizeof(tracked)];
+
+    SECTION("emplace_back")
+    {
+        auto buffer = out_buffer<tracked>(storage, 4u);
+        REQUIRE(buffer.written() == 0u);
+        REQUIRE(buffer.capacity() == 4u);
+        REQUIRE(!buffer.full());
+
+        tracked& first = buffer.emplace_back(1);
+        REQUIRE(first.value == 1);
+        REQUIRE(buffer.written() == 1u);
+
+        buffer.emplace_back(2);
+        buffer.emplace_back(3);
+        buffer.emplace_back(4);
+        REQUIRE(buffer.written() == 4u);
+        REQUIRE(buffer.full());
+        REQUIRE(tracked::alive == 4);
+    }
+    // everything written was destroyed again
+    REQUIRE(tracked::alive == 0);
+
+    SECTION("release")
+    {
+        tracked* objects = nullptr;
+        {
+            auto buffer = out_buffer<tracked>(storage, 4u);
+            buffer.emplace_back(11);
+            buffer.emplace_back(22);
+
+            objects = buffer.release();
+        }
+        // ownership was handed off, the buffer did not destroy them
+        REQUIRE(tracked::alive == 2);
+        REQUIRE(objects == reinterpret_cast<tracked*>(storage));
+        REQUIRE(objects[0].value == 11);
+        REQUIRE(objects[1].value == 22);
+
+        objects[1].~tracked();
+        objects[0].~tracked();
+        REQUIRE(tracked::alive == 0);
+    }
+    SECTION("non-trivial type")
+    {
+        alignas(std::string) unsigned char string_storage[2 * sizeof(std::string)];
+
+        auto buffer = out_buffer<std::string>(string_storage, 2u);
+        buffer.emplace_back(3u, 'c');
+        std::string& str = buffer.emplace_back("abc");
+        REQUIRE(str == "abc");
+        REQUIRE(buffer.written() == 2u);
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/packed_bool_vector.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+TEST_CASE("packed_bool_vector")
+{
+    packed_bool_vector flags;
+    REQUIRE(flags.empty());
+    REQUIRE(flags.size() == 0u);
+    REQUIRE(static_cast<bool>(flags.none()));
+
+    SECTION("push_back/pop_back")
+    {
+        // cross a word boundary to exercise the packing
+        for (auto i = 0u; i != 70u; ++i)
+            flags.push_back(boolean(i % 3u == 0u));
+        REQUIRE(flags.size() == 70u);
+        REQUIRE(flags.count() == 24u);
+
+        REQUIRE(static_cast<bool>(flags[0u]));
+        REQUIRE(!static_cast<bool>(flags[1u]));
+        REQUIRE(static_cast<bool>(flags[69u]));
+
+        flags.pop_back();
+        REQUIRE(flags.size() == 69u);
+        REQUIRE(flags.count() == 23u);
+    }
+    SECTION("proxy write")
+    {
+        flags = packed_bool_vector(70u);
+        REQUIRE(flags.count() == 0u);
+
+        flags[65u] = boolean(true);
+        REQUIRE(static_cast<bool>(flags[65u]));
+        REQUIRE(flags.count() == 1u);
+        REQUIRE(static_cast<bool>(flags.any()));
+
+        flags[65u] = boolean(false);
+        REQUIRE(static_cast<bool>(flags.none()));
+    }
+    SECTION("aggregate queries")
+    {
+        auto all_set = packed_bool_vector(70u, boolean(true));
+        REQUIRE(all_set.count() == 70u);
+        REQUIRE(static_cast<bool>(all_set.all()));
+
+        all_set[42u] = boolean(false);
+        REQUIRE(!static_cast<bool>(all_set.all()));
+        REQUIRE(static_cast<bool>(all_set.any()));
+        REQUIRE(all_set.count() == 69u);
+    }
+    SECTION("logical operations")
+    {
+        auto a = packed_bool_vector(70u);
+        auto b = packed_bool_vector(70u);
+        for (auto i = 0u; i != 70u; ++i)
+        {
+            a[i] = boolean(i % 2u == 0u);
+            b[i] = boolean(i % 3u == 0u);
+        }
+
+        auto both = a & b;
+        REQUIRE(both.count() == 12u); // multiples of 6 below 70
+
+        auto either = a | b;
+        REQUIRE(either.count() == 35u + 24u - 12u);
+
+        auto exclusive = a ^ b;
+        REQUIRE(exclusive.count() == 35u + 24u - 2u * 12u);
+
+        // flip() must not set the unused bits of the last word
+        auto none_set = packed_bool_vector(70u);
+        none_set.flip();
+        REQUIRE(none_set.count() == 70u);
+        REQUIRE(static_cast<bool>(none_set.all()));
+    }
+}
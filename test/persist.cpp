@@ -0,0 +1,109 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/persist.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <type_safe/bounded_type.hpp>
+#include <type_safe/strong_typedef.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+struct node_id : strong_typedef<node_id, std::uint64_t>,
+                 strong_typedef_op::equality_comparison<node_id>
+{
+    using strong_typedef::strong_typedef;
+};
+
+using percentage
+    = bounded_type<int, true, true, lit_detail::integer_bound<long long, 0>,
+                   lit_detail::integer_bound<long long, 100>>;
+} // namespace
+
+static_assert(is_memcpy_safe<std::uint64_t>::value, "");
+static_assert(is_memcpy_safe<node_id>::value, "");
+static_assert(is_memcpy_safe<percentage>::value, "");
+static_assert(!is_memcpy_safe<std::vector<int>>::value, "");
+
+// different layout, different fingerprint
+static_assert(layout_fingerprint<std::uint64_t>() != layout_fingerprint<std::uint32_t>(), "");
+
+TEST_CASE("persist strong_typedef")
+{
+    std::vector<node_id> ids;
+    for (auto i = 0u; i != 100u; ++i)
+        ids.push_back(node_id(i * i));
+
+    std::vector<char> snapshot(persist_size<node_id>(ids.size()));
+    store_span(cref(ids.data(), ids.size()), snapshot.data(), snapshot.size());
+
+    auto span = load_span<node_id>(snapshot.data(), snapshot.size());
+    REQUIRE(static_cast<std::size_t>(span.size()) == ids.size());
+    // the span views the mapped bytes directly
+    REQUIRE(static_cast<const void*>(span.data())
+            == static_cast<const void*>(snapshot.data() + sizeof(persist_header)));
+    REQUIRE(span[42u] == node_id(42u * 42u));
+}
+
+TEST_CASE("persist bounded_type")
+{
+    std::vector<percentage> values;
+    for (auto i = 0; i != 100; ++i)
+        values.push_back(make_bounded(i, 0_bound, 100_bound));
+
+    std::vector<char> snapshot(persist_size<percentage>(values.size()));
+    store_span(cref(values.data(), values.size()), snapshot.data(), snapshot.size());
+
+    SECTION("valid values")
+    {
+        auto span = load_span<percentage>(snapshot.data(), snapshot.size());
+        REQUIRE(span[99u].get_value() == 99);
+    }
+    SECTION("corrupted value is rejected")
+    {
+        // flip one element to an out-of-bounds value
+        auto corrupted = 1000;
+        std::memcpy(snapshot.data() + sizeof(persist_header) + 50u * sizeof(percentage),
+                    &corrupted, sizeof(corrupted));
+
+        REQUIRE_THROWS_AS(load_span<percentage>(snapshot.data(), snapshot.size()),
+                          persist_error);
+    }
+}
+
+TEST_CASE("persist errors")
+{
+    std::vector<char> snapshot(persist_size<node_id>(4u));
+    node_id           ids[] = {node_id(1u), node_id(2u), node_id(3u), node_id(4u)};
+    store_span(cref(ids, 4u), snapshot.data(), snapshot.size());
+
+    SECTION("truncated header")
+    {
+        REQUIRE_THROWS_AS(load_span<node_id>(snapshot.data(), 4u), persist_error);
+    }
+    SECTION("truncated elements")
+    {
+        REQUIRE_THROWS_AS(load_span<node_id>(snapshot.data(), snapshot.size() - 1u),
+                          persist_error);
+    }
+    SECTION("mismatched fingerprint")
+    {
+        REQUIRE_THROWS_AS(load_span<std::uint32_t>(snapshot.data(), snapshot.size()),
+                          persist_error);
+    }
+    SECTION("count overflowing the size computation")
+    {
+        // a count chosen so that count * sizeof(T) wraps around to a tiny value
+        auto corrupted = snapshot;
+        auto count     = std::uint64_t(-1) / sizeof(node_id);
+        std::memcpy(corrupted.data() + sizeof(std::uint64_t), &count, sizeof(count));
+        REQUIRE_THROWS_AS(load_span<node_id>(corrupted.data(), corrupted.size()), persist_error);
+    }
+}
@@ -0,0 +1,152 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/raw_union.hpp>
+
+#include <catch.hpp>
+
+#include "debugger_type.hpp"
+
+using namespace type_safe;
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+// without the discriminant the union is as big as its biggest type
+static_assert(sizeof(raw_union<int, float>) == sizeof(int), "");
+static_assert(sizeof(raw_union<int, double>) == sizeof(double), "");
+static_assert(std::is_trivially_copyable<raw_union<int, float>>::value, "");
+static_assert(!std::is_copy_constructible<raw_union<int, debugger_type>>::value, "");
+#endif
+
+TEST_CASE("raw_union")
+{
+    using union_t = raw_union<int, double, debugger_type>;
+
+    union_t runion;
+    auto    id = union_t::invalid_type;
+
+    SECTION("emplace int")
+    {
+        id = runion.emplace(union_type<int>{}, 5);
+        REQUIRE(id == union_t::type_id(union_type<int>{}));
+        REQUIRE(runion.value(union_type<int>{}) == 5);
+
+        runion.destroy(union_type<int>{});
+    }
+    SECTION("emplace debugger_type")
+    {
+        id = runion.emplace(union_type<debugger_type>{}, 42);
+        REQUIRE(id == union_t::type_id(union_type<debugger_type>{}));
+        REQUIRE(runion.value(union_type<debugger_type>{}).id == 42);
+        REQUIRE(runion.value(union_type<debugger_type>{}).ctor());
+
+        runion.destroy(union_type<debugger_type>{});
+    }
+    SECTION("with")
+    {
+        struct visitor
+        {
+            int expected;
+
+            void operator()(int i) const
+            {
+                REQUIRE(i == expected);
+            }
+
+            void operator()(double) const
+            {
+                REQUIRE(false);
+            }
+
+            void operator()(const debugger_type&) const
+            {
+                REQUIRE(false);
+            }
+        };
+
+        // an invalid id does nothing
+        with(runion, id, visitor{0});
+
+        id = runion.emplace(union_type<int>{}, 7);
+        with(runion, id, visitor{7});
+
+        runion.destroy(union_type<int>{});
+    }
+}
+
+TEST_CASE("tagged_array")
+{
+    tagged_array<int, float> array;
+    REQUIRE(array.empty());
+    REQUIRE(array.size() == 0u);
+
+    SECTION("push_back/value")
+    {
+        array.push_back(union_type<int>{}, 1);
+        array.push_back(union_type<float>{}, 2.f);
+        array.push_back(union_type<int>{}, 3);
+        REQUIRE(array.size() == 3u);
+
+        REQUIRE(array.has_type<int>(0u));
+        REQUIRE(array.has_type<float>(1u));
+        REQUIRE(array.has_type<int>(2u));
+        REQUIRE(!array.has_type<float>(0u));
+
+        REQUIRE(array.value(0u, union_type<int>{}) == 1);
+        REQUIRE(array.value(1u, union_type<float>{}) == 2.f);
+        REQUIRE(array.value(2u, union_type<int>{}) == 3);
+
+        array.value(2u, union_type<int>{}) = 4;
+        REQUIRE(array.value(2u, union_type<int>{}) == 4);
+    }
+    SECTION("with/for_each")
+    {
+        array.reserve(100u);
+        auto expected = 0;
+        for (auto i = 0; i != 100; ++i)
+            if (i % 2 == 0)
+            {
+                array.push_back(union_type<int>{}, i);
+                expected += i;
+            }
+            else
+            {
+                array.push_back(union_type<float>{}, float(i));
+                expected += i;
+            }
+
+        struct visitor
+        {
+            int sum = 0;
+
+            void operator()(int i)
+            {
+                sum += i;
+            }
+
+            void operator()(float f)
+            {
+                sum += int(f);
+            }
+        } v;
+
+        const auto& carray = array;
+        carray.for_each(v);
+        REQUIRE(v.sum == expected);
+
+        array.with(0u, v);
+        REQUIRE(v.sum == expected + 0);
+    }
+    SECTION("pop_back/clear")
+    {
+        array.push_back(union_type<int>{}, 1);
+        array.push_back(union_type<float>{}, 2.f);
+
+        array.pop_back();
+        REQUIRE(array.size() == 1u);
+        REQUIRE(array.has_type<int>(0u));
+
+        array.clear();
+        REQUIRE(array.empty());
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/recursive_variant.hpp>
+
+#include <catch.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+struct binary_expr;
+using expr      = variant<int, recursive_wrapper<binary_expr>>;
+using expr_node = recursive_wrapper<binary_expr>;
+
+struct binary_expr
+{
+    char op;
+    expr lhs;
+    expr rhs;
+};
+
+int evaluate(const expr& e)
+{
+    if (e.has_value(variant_type<int>{}))
+        return e.value(variant_type<int>{});
+
+    auto& node = e.value(variant_type<expr_node>{}).value();
+    auto  l    = evaluate(node.lhs);
+    auto  r    = evaluate(node.rhs);
+    return node.op == '+' ? l + r : l * r;
+}
+
+struct tracked
+{
+    static int dtors;
+
+    ~tracked()
+    {
+        ++dtors;
+    }
+};
+
+int tracked::dtors = 0;
+} // namespace
+
+TEST_CASE("monotonic_arena")
+{
+    monotonic_arena arena(64u);
+    REQUIRE(arena.slab_count() == 0u);
+
+    auto a = arena.allocate(16u, 8u);
+    auto b = arena.allocate(16u, 8u);
+    REQUIRE(a != b);
+    REQUIRE(arena.slab_count() == 1u);
+
+    // larger than the slab size, gets its own slab
+    auto c = arena.allocate(128u, 8u);
+    REQUIRE(c != nullptr);
+    REQUIRE(arena.slab_count() == 2u);
+
+    arena.release();
+    REQUIRE(arena.slab_count() == 0u);
+}
+
+TEST_CASE("recursive_wrapper")
+{
+    monotonic_arena arena;
+
+    SECTION("tree construction")
+    {
+        // (1 + 2) * 3
+        expr sum(expr_node(arena, binary_expr{'+', expr(1), expr(2)}));
+        expr product(expr_node(arena, binary_expr{'*', std::move(sum), expr(3)}));
+
+        REQUIRE(evaluate(product) == 9);
+        REQUIRE(arena.slab_count() == 1u);
+    }
+    SECTION("copy and move")
+    {
+        expr_node node(arena, binary_expr{'+', expr(1), expr(2)});
+
+        auto copy = node;
+        copy.value().lhs = expr(10);
+        REQUIRE(evaluate(expr(std::move(copy))) == 12);
+        REQUIRE(evaluate(expr(std::move(node))) == 3);
+    }
+    SECTION("bulk allocation")
+    {
+        monotonic_arena big_arena(std::size_t(1) << 16);
+
+        expr tree(0);
+        for (auto i = 1; i != 1000; ++i)
+            tree = expr(expr_node(big_arena, binary_expr{'+', std::move(tree), expr(i)}));
+
+        REQUIRE(evaluate(tree) == 999 * 1000 / 2);
+        // a thousand nodes, a handful of slabs
+        REQUIRE(big_arena.slab_count() <= 4u);
+    }
+    SECTION("non-trivial destructor runs")
+    {
+        auto before = tracked::dtors;
+        {
+            recursive_wrapper<tracked> wrapper(arena, tracked{});
+            auto                       in_scope = tracked::dtors;
+            (void)in_scope;
+            before = tracked::dtors;
+        }
+        REQUIRE(tracked::dtors == before + 1);
+    }
+}
@@ -3,14 +3,20 @@
 // found in the top-level directory of this distribution.
 
 #include <type_safe/reference.hpp>
+#include <type_safe/strong_typedef.hpp>
 
 #include <catch.hpp>
+#include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "debugger_type.hpp"
 
 using type_safe::array_ref;
+using type_safe::array_ref_2d;
+using type_safe::difference_t;
 using type_safe::function_ref;
+using type_safe::index_t;
 using type_safe::object_ref;
 using type_safe::cref;
 using type_safe::ref;
@@ -203,6 +209,133 @@ TEST_CASE("array_ref")
     }
 }
 
+TEST_CASE("no_alias_ref")
+{
+    int value = 42;
+
+    auto ref = type_safe::ref_no_alias(value);
+    REQUIRE(&ref.get() == &value);
+    REQUIRE(*ref == 42);
+
+    *ref = 43;
+    REQUIRE(value == 43);
+
+    auto cref = type_safe::cref_no_alias(value);
+    REQUIRE(&cref.get() == &value);
+
+    // drops back to a plain object_ref
+    object_ref<int> plain = ref;
+    REQUIRE(&plain.get() == &value);
+}
+
+TEST_CASE("no_alias_array_ref")
+{
+    int in[4]  = {1, 2, 3, 4};
+    int out[4] = {};
+
+    // the classic kernel shape: distinct input and output arrays
+    auto source = type_safe::cref_no_alias(in);
+    auto dest   = type_safe::ref_no_alias(out, 4u);
+    REQUIRE((source.size() == 4u));
+    REQUIRE((dest.size() == 4u));
+
+    for (std::size_t i = 0u; i != 4u; ++i)
+        dest[i] = source[i] * 2;
+    REQUIRE(out[2] == 6);
+
+    auto sum = 0;
+    for (auto value : source)
+        sum += value;
+    REQUIRE(sum == 10);
+
+    // drops back to a plain array_ref
+    array_ref<int> plain = dest;
+    REQUIRE(plain.data() == out);
+    REQUIRE((plain.size() == 4u));
+}
+
+TEST_CASE("array_ref_2d")
+{
+    // 3 rows, 4 columns, row major
+    int matrix[12] = {0, 1, 2, 3, 10, 11, 12, 13, 20, 21, 22, 23};
+
+    array_ref_2d<int> ref(matrix, 3u, 4u);
+    REQUIRE(ref.data() == matrix);
+    REQUIRE((ref.rows() == 3u));
+    REQUIRE((ref.columns() == 4u));
+    REQUIRE((ref.row_stride() == 4u));
+    REQUIRE((ref.size() == 12u));
+
+    REQUIRE(ref(0u, 0u) == 0);
+    REQUIRE(ref(1u, 2u) == 12);
+    REQUIRE(ref(2u, 3u) == 23);
+
+    ref(1u, 1u) = 100;
+    REQUIRE(matrix[5] == 100);
+
+    SECTION("row")
+    {
+        auto row = ref.row(2u);
+        REQUIRE(row.data() == matrix + 8);
+        REQUIRE((row.size() == 4u));
+        REQUIRE(row[1u] == 21);
+    }
+    SECTION("block")
+    {
+        // the 2x2 bottom right corner, strided view
+        auto block = ref.block(1u, 2u, 2u, 2u);
+        REQUIRE((block.rows() == 2u));
+        REQUIRE((block.columns() == 2u));
+        REQUIRE((block.row_stride() == 4u));
+        REQUIRE(block(0u, 0u) == 12);
+        REQUIRE(block(1u, 1u) == 23);
+
+        block(1u, 0u) = 200;
+        REQUIRE(matrix[10] == 200);
+    }
+    SECTION("for_each_tile")
+    {
+        // 2x2 tiles over 3x4 don't divide evenly, the bottom edge tiles are 1x2
+        int  visited[12] = {};
+        auto tiles       = 0;
+        ref.for_each_tile<2, 2>([&](const array_ref_2d<int>& tile, index_t row, index_t column) {
+            ++tiles;
+            auto top  = static_cast<std::size_t>(get(row));
+            auto left = static_cast<std::size_t>(get(column));
+            for (std::size_t r = 0u; r != static_cast<std::size_t>(tile.rows()); ++r)
+                for (std::size_t c = 0u; c != static_cast<std::size_t>(tile.columns()); ++c)
+                {
+                    REQUIRE(&tile(r, c) == matrix + (top + r) * 4u + (left + c));
+                    ++visited[(top + r) * 4u + (left + c)];
+                }
+        });
+        REQUIRE(tiles == 4);
+        for (auto count : visited)
+            REQUIRE(count == 1);
+    }
+    SECTION("prefetch")
+    {
+        // a hint only: in particular, targets outside the matrix are ignored
+        ref.prefetch(0u, difference_t(2));
+        ref.prefetch(2u, difference_t(2));
+        ref.prefetch(0u, difference_t(-1));
+        REQUIRE(ref(2u, 3u) == 23);
+    }
+    SECTION("ref/cref")
+    {
+        auto a = type_safe::ref(matrix, 3u, 4u);
+        REQUIRE(a.data() == matrix);
+        REQUIRE((a.rows() == 3u));
+
+        // view only the left two columns via the stride
+        auto b = type_safe::cref(matrix, 3u, 2u, 4u);
+        REQUIRE(b(2u, 1u) == 21);
+
+        array_ref_2d<int> null_view(nullptr);
+        REQUIRE((null_view.size() == 0u));
+    }
+}
+
 // fake polymorphic lambda, due to C++11 requirement
 struct lambda
 {
@@ -333,4 +466,79 @@ TEST_CASE("function_ref")
         a.assign(g);
         REQUIRE(a() == 1);
     }
+    SECTION("assignment between direct and functor mode")
+    {
+        // exact signature match, stored as bare function pointer
+        auto f = static_cast<int (*)(int, int)>([](int a, int b) { return a + b; });
+        // stateful functor, stored behind the callback
+        struct functor
+        {
+            int factor;
+
+            int operator()(int a, int b)
+            {
+                return factor * (a + b);
+            }
+        } g{2};
+
+        function_ref<int(int, int)> a(f);
+        REQUIRE(a(1, 3) == 4);
+
+        a.assign(g);
+        REQUIRE(a(1, 3) == 8);
+
+        a.assign(f);
+        REQUIRE(a(1, 3) == 4);
+    }
+}
+
+namespace
+{
+struct order_id : type_safe::strong_typedef<order_id, std::uint64_t>
+{
+    using strong_typedef::strong_typedef;
+};
+} // namespace
+
+TEST_CASE("underlying_array_ref")
+{
+    order_id ids[] = {order_id(1u), order_id(2u), order_id(3u)};
+
+    SECTION("mutable view")
+    {
+        auto raw = type_safe::underlying_array_ref(ids, 3u);
+        static_assert(std::is_same<decltype(raw), array_ref<std::uint64_t>>::value, "");
+        REQUIRE(raw.size() == 3u);
+        REQUIRE(static_cast<void*>(raw.data()) == static_cast<void*>(ids));
+        REQUIRE(raw[1u] == 2u);
+
+        raw[1u] = 42u;
+        REQUIRE(type_safe::get(ids[1]) == 42u);
+    }
+    SECTION("const view")
+    {
+        const order_id* cids = ids;
+        auto            raw  = type_safe::underlying_array_ref(cids, 3u);
+        static_assert(std::is_same<decltype(raw), array_ref<const std::uint64_t>>::value, "");
+        REQUIRE(raw[2u] == 3u);
+    }
+    SECTION("container")
+    {
+        std::vector<order_id> vec(ids, ids + 3);
+        auto                  raw = type_safe::underlying_array_ref(vec);
+        REQUIRE(raw.size() == 3u);
+        REQUIRE(raw[0u] == 1u);
+    }
+    SECTION("inverse")
+    {
+        std::uint64_t buffer[] = {4u, 5u};
+
+        auto typed = type_safe::strong_array_ref<order_id>(buffer, 2u);
+        static_assert(std::is_same<decltype(typed), array_ref<order_id>>::value, "");
+        REQUIRE(typed.size() == 2u);
+        REQUIRE(type_safe::get(typed[0u]) == 4u);
+
+        typed[1u] = order_id(6u);
+        REQUIRE(buffer[1] == 6u);
+    }
 }
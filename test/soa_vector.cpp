@@ -0,0 +1,88 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/soa_vector.hpp>
+
+#include <catch.hpp>
+#include <cstdint>
+
+using namespace type_safe;
+
+namespace
+{
+struct price : strong_typedef<price, double>
+{
+    using strong_typedef::strong_typedef;
+};
+
+struct quantity : strong_typedef<quantity, std::uint32_t>
+{
+    using strong_typedef::strong_typedef;
+};
+
+struct sequence_no : strong_typedef<sequence_no, std::uint64_t>
+{
+    using strong_typedef::strong_typedef;
+};
+
+using tick_vector = soa_vector<price, quantity, sequence_no>;
+} // namespace
+
+TEST_CASE("soa_vector")
+{
+    tick_vector ticks;
+    REQUIRE(ticks.empty());
+    REQUIRE(ticks.size() == 0u);
+
+    ticks.reserve(4u);
+    ticks.push_back(price(1.5), quantity(10u), sequence_no(1u));
+    ticks.push_back(price(2.5), quantity(20u), sequence_no(2u));
+    ticks.push_back(price(3.5), quantity(30u), sequence_no(3u));
+    REQUIRE(!ticks.empty());
+    REQUIRE(ticks.size() == 3u);
+
+    SECTION("record proxy")
+    {
+        auto record = ticks[1u];
+        REQUIRE(get(record.get<price>()) == 2.5);
+        REQUIRE(get(record.get<quantity>()) == 20u);
+
+        record.get<quantity>() = quantity(25u);
+        REQUIRE(get(ticks[1u].get<quantity>()) == 25u);
+
+        const tick_vector& cticks = ticks;
+        REQUIRE(get(cticks[2u].get<sequence_no>()) == 3u);
+    }
+    SECTION("typed column")
+    {
+        auto prices = ticks.column<price>();
+        REQUIRE(prices.size() == 3u);
+        REQUIRE(get(prices[0u]) == 1.5);
+
+        prices[0u] = price(1.0);
+        REQUIRE(get(ticks[0u].get<price>()) == 1.0);
+    }
+    SECTION("underlying column")
+    {
+        auto raw = ticks.underlying_column<quantity>();
+        static_assert(std::is_same<decltype(raw), array_ref<std::uint32_t>>::value, "");
+
+        auto sum = 0u;
+        for (auto q : raw)
+            sum += q;
+        REQUIRE(sum == 60u);
+
+        // the column is contiguous storage of the underlying type
+        REQUIRE(raw.data() + 1 == &raw[1u]);
+    }
+    SECTION("pop_back/clear")
+    {
+        ticks.pop_back();
+        REQUIRE(ticks.size() == 2u);
+        REQUIRE(ticks.column<sequence_no>().size() == 2u);
+
+        ticks.clear();
+        REQUIRE(ticks.empty());
+    }
+}
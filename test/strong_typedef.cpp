@@ -6,6 +6,7 @@
 
 #include <catch.hpp>
 
+#include <cstdint>
 #include <sstream>
 
 using namespace type_safe;
@@ -614,4 +615,40 @@ TEST_CASE("strong_typedef")
         REQUIRE(is_strong_typedef<strong>::value);
         REQUIRE(!is_strong_typedef<int>::value);
     }
+    SECTION("fast_hashable")
+    {
+        struct type : strong_typedef<type, std::uint64_t>
+        {
+            using strong_typedef::strong_typedef;
+        };
+
+        fast_hashable<type> hash;
+
+        // sequential ids must not land in sequential buckets
+        REQUIRE(hash(type(1u)) != 1u);
+        REQUIRE(hash(type(1u)) != hash(type(2u)));
+        REQUIRE(hash(type(1u)) + 1u != hash(type(2u)));
+
+#if TYPE_SAFE_USE_CONSTEXPR14
+        static_assert(fast_hashable<type>{}(type(42u)) != 42u, "mixer must not be the identity");
+#endif
+    }
+#if TYPE_SAFE_USE_THREE_WAY_COMPARISON
+    SECTION("three_way_comparison")
+    {
+        struct type : strong_typedef<type, int>,
+                      strong_typedef_op::equality_comparison<type>,
+                      strong_typedef_op::three_way_comparison<type>
+        {
+            using strong_typedef::strong_typedef;
+        };
+
+        type a(0), b(1);
+        REQUIRE((a <=> b) == std::strong_ordering::less);
+        REQUIRE((a <=> a) == std::strong_ordering::equal);
+        REQUIRE(a < b);
+        REQUIRE(b >= a);
+        REQUIRE(a == a);
+    }
+#endif
 }
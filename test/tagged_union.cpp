@@ -10,6 +10,26 @@
 
 using namespace type_safe;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(std::is_trivially_copyable<tagged_union<int, double>>::value, "");
+static_assert(std::is_trivially_destructible<tagged_union<int, double>>::value, "");
+static_assert(!std::is_copy_constructible<tagged_union<int, debugger_type>>::value, "");
+// the discriminant only occupies a single byte for a small number of types
+static_assert(sizeof(tagged_union<int, float>) == 2 * sizeof(int), "");
+
+// the storage honors over-aligned types, e.g. SIMD payloads
+struct alignas(32) avx_payload
+{
+    float lanes[8];
+};
+struct alignas(64) cache_line_payload
+{
+    char bytes[64];
+};
+static_assert(alignof(tagged_union<int, avx_payload>) == 32, "");
+static_assert(alignof(tagged_union<int, cache_line_payload>) == 64, "");
+#endif
+
 TEST_CASE("tagged_union")
 {
     using union_t = tagged_union<int, double, debugger_type>;
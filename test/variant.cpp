@@ -21,6 +21,21 @@ using type_safe::variant_type;
 using variant_t = variant<nullvar_t, int, double, debugger_type>;
 using union_t   = tagged_union<int, double, debugger_type>;
 
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+static_assert(std::is_trivially_copyable<variant<int, double>>::value, "");
+static_assert(std::is_trivially_destructible<variant<int, double>>::value, "");
+static_assert(!std::is_trivially_copyable<variant_t>::value, "");
+static_assert(!std::is_trivially_destructible<variant_t>::value, "");
+static_assert(sizeof(variant<int, float>) == 2 * sizeof(int), "");
+
+// over-aligned alternatives propagate their alignment to the variant
+struct alignas(32) simd_alternative
+{
+    float lanes[8];
+};
+static_assert(alignof(variant<int, simd_alternative>) == 32, "");
+#endif
+
 template <class Variant>
 void check_variant_empty(const Variant& var)
 {
@@ -710,3 +725,38 @@ TEST_CASE("rarely_empty_variant")
         check_variant_empty(var);
     }
 }
+
+TEST_CASE("relocating_variant")
+{
+    using var_t = type_safe::relocating_variant<int, float, double>;
+
+#ifndef TYPE_SAFE_TEST_NO_STATIC_ASSERT
+    static_assert(std::is_trivially_copyable<var_t>::value, "");
+    static_assert(std::is_trivially_destructible<var_t>::value, "");
+#endif
+
+    var_t var(3);
+    check_variant_value(var, 3);
+
+    SECTION("change alternative")
+    {
+        var = 3.14f;
+        check_variant_value(var, 3.14f);
+
+        var = 42.0;
+        check_variant_value(var, 42.0);
+
+        var.emplace(variant_type<int>{}, 7);
+        check_variant_value(var, 7);
+    }
+    SECTION("copy is a byte copy")
+    {
+        var      = 3.14f;
+        auto cpy = var;
+        check_variant_value(cpy, 3.14f);
+
+        cpy = var_t(11);
+        check_variant_value(cpy, 11);
+        check_variant_value(var, 3.14f);
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2016-2020 Jonathan Müller <jonathanmueller.dev@gmail.com>
+// This file is subject to the license terms in the LICENSE file
+// found in the top-level directory of this distribution.
+
+#include <type_safe/violation_handler.hpp>
+
+#include <catch.hpp>
+
+#include <cstring>
+
+#include <type_safe/flag.hpp>
+
+using namespace type_safe;
+
+namespace
+{
+// always enabled, regardless of the build configuration of the checks
+struct enabled_handler : debug_assert::set_level<1>, debug_assert::default_handler
+{};
+
+violation_kind last_kind = violation_kind::precondition;
+const char*    last_file = nullptr;
+unsigned       last_line = 0u;
+const char*    last_expr = nullptr;
+const char*    last_msg  = nullptr;
+int            handled   = 0;
+
+bool record_violation(const violation_info& info)
+{
+    last_kind = info.kind;
+    last_file = info.file_name;
+    last_line = info.line_number;
+    last_expr = info.expression;
+    last_msg  = info.message;
+    ++handled;
+    return true;
+}
+} // namespace
+
+TEST_CASE("set_violation_handler")
+{
+    // default installed
+    REQUIRE(set_violation_handler(&record_violation) == nullptr);
+    // returns the previous one
+    REQUIRE(set_violation_handler(nullptr) == &record_violation);
+    REQUIRE(set_violation_handler(nullptr) == nullptr);
+}
+
+TEST_CASE("violation_handler continue")
+{
+    set_violation_handler(&record_violation);
+    handled = 0;
+
+    auto value = 0;
+    auto line  = unsigned(__LINE__ + 1);
+    TYPE_SAFE_DETAIL_ASSERT(value == 1, enabled_handler{}, "value must be one");
+    // the handler returned true, so execution continues
+    REQUIRE(handled == 1);
+    REQUIRE(last_kind == violation_kind::assertion);
+    REQUIRE(std::strcmp(last_file, __FILE__) == 0);
+    REQUIRE(last_line == line);
+    REQUIRE(std::strcmp(last_expr, "value == 1") == 0);
+    REQUIRE(std::strcmp(last_msg, "value must be one") == 0);
+
+    // a passing check never reaches the handler
+    TYPE_SAFE_DETAIL_ASSERT(value == 0, enabled_handler{});
+    REQUIRE(handled == 1);
+
+    set_violation_handler(nullptr);
+}
+
+#if TYPE_SAFE_ENABLE_PRECONDITION_CHECKS
+TEST_CASE("violation_handler precondition kind")
+{
+    set_violation_handler(&record_violation);
+    handled = 0;
+
+    // violates the precondition of flag::change(), continuing just stores the same state
+    flag f(true);
+    f.change(true);
+    REQUIRE(handled == 1);
+    REQUIRE(last_kind == violation_kind::precondition);
+    REQUIRE(f == true);
+
+    set_violation_handler(nullptr);
+}
+#endif
+
+TEST_CASE("count_violations")
+{
+    set_violation_handler(&count_violations);
+
+    auto value = 0;
+    auto line_a = unsigned(__LINE__ + 2);
+    for (auto i = 0; i != 3; ++i)
+        TYPE_SAFE_DETAIL_ASSERT(value == 1, enabled_handler{});
+    auto line_b = unsigned(__LINE__ + 1);
+    TYPE_SAFE_DETAIL_ASSERT(value == 2, enabled_handler{}, "other site");
+
+    set_violation_handler(nullptr);
+
+    auto count_a = 0ull;
+    auto count_b = 0ull;
+    for_each_violation([&](const violation_info& info, unsigned long long count) {
+        if (std::strcmp(info.file_name, __FILE__) != 0)
+            return;
+        if (info.line_number == line_a)
+        {
+            count_a = count;
+            REQUIRE(std::strcmp(info.expression, "value == 1") == 0);
+        }
+        else if (info.line_number == line_b)
+        {
+            count_b = count;
+            REQUIRE(info.kind == violation_kind::assertion);
+        }
+    });
+    REQUIRE(count_a == 3u);
+    REQUIRE(count_b == 1u);
+}
@@ -4,6 +4,10 @@
 
 #include <type_safe/visitor.hpp>
 
+#include <atomic>
+#include <forward_list>
+#include <vector>
+
 #include <catch.hpp>
 
 using type_safe::nullopt_t;
@@ -195,3 +199,212 @@ TEST_CASE("visit variant")
         REQUIRE(visit([](int, int) { return 0; }, a, b) == 0);
     }
 }
+
+TEST_CASE("visit_all")
+{
+    struct visitor
+    {
+        int  int_sum   = 0;
+        int  int_count = 0;
+        bool int_batch = true;
+
+        float float_sum   = 0.f;
+        int   float_count = 0;
+
+        int empty_count = 0;
+
+        void operator()(nullvar_t)
+        {
+            ++empty_count;
+        }
+
+        void operator()(int i)
+        {
+            // all ints are visited as one batch,
+            // no float may come in between
+            if (float_count != 0)
+                int_batch = false;
+
+            int_sum += i;
+            ++int_count;
+        }
+
+        void operator()(float f)
+        {
+            float_sum += f;
+            ++float_count;
+        }
+    };
+
+    SECTION("random access")
+    {
+        std::vector<variant<nullvar_t, int, float>> vec;
+        vec.push_back(1);
+        vec.push_back(1.f);
+        vec.push_back(2);
+        vec.push_back(type_safe::nullvar);
+        vec.push_back(2.f);
+        vec.push_back(3);
+
+        visitor v;
+        type_safe::visit_all(vec.begin(), vec.end(), v);
+
+        REQUIRE(v.int_sum == 6);
+        REQUIRE(v.int_count == 3);
+        REQUIRE(v.int_batch);
+        REQUIRE(v.float_sum == 3.f);
+        REQUIRE(v.float_count == 2);
+        REQUIRE(v.empty_count == 1);
+    }
+    SECTION("forward")
+    {
+        std::forward_list<variant<nullvar_t, int, float>> list;
+        list.push_front(1.f);
+        list.push_front(2);
+        list.push_front(1);
+
+        visitor v;
+        type_safe::visit_all(list.begin(), list.end(), v);
+
+        REQUIRE(v.int_sum == 3);
+        REQUIRE(v.int_count == 2);
+        REQUIRE(v.float_sum == 1.f);
+        REQUIRE(v.float_count == 1);
+        REQUIRE(v.empty_count == 0);
+    }
+}
+
+#if TYPE_SAFE_USE_PARALLEL_VISIT
+TEST_CASE("visit_all parallel")
+{
+    struct visitor
+    {
+        std::atomic<int>* sum;
+
+        void operator()(nullvar_t) const {}
+
+        void operator()(int i) const
+        {
+            *sum += i;
+        }
+
+        void operator()(float f) const
+        {
+            *sum += int(f);
+        }
+    };
+
+    std::vector<variant<nullvar_t, int, float>> vec;
+    auto                                        expected = 0;
+    for (auto i = 0; i != 1024; ++i)
+    {
+        if (i % 3 == 0)
+            vec.push_back(type_safe::nullvar);
+        else if (i % 3 == 1)
+        {
+            vec.push_back(i);
+            expected += i;
+        }
+        else
+        {
+            vec.push_back(float(i));
+            expected += i;
+        }
+    }
+
+    std::atomic<int> sum{0};
+    type_safe::visit(std::execution::par_unseq, vec.begin(), vec.end(), visitor{&sum});
+    REQUIRE(sum == expected);
+
+    sum = 0;
+    type_safe::visit(std::execution::seq, vec.begin(), vec.end(), visitor{&sum});
+    REQUIRE(sum == expected);
+}
+#endif
+
+TEST_CASE("visit_masked optional")
+{
+    struct visitor
+    {
+        int sum;
+
+        int operator()(nullopt_t, nullopt_t, nullopt_t) const
+        {
+            return sum == 0 ? 1 : 0;
+        }
+
+        int operator()(int a, nullopt_t, nullopt_t) const
+        {
+            return a == sum ? 1 : 0;
+        }
+
+        int operator()(nullopt_t, int b, nullopt_t) const
+        {
+            return b == sum ? 1 : 0;
+        }
+
+        int operator()(nullopt_t, nullopt_t, int c) const
+        {
+            return c == sum ? 1 : 0;
+        }
+
+        int operator()(int a, int b, nullopt_t) const
+        {
+            return a + b == sum ? 1 : 0;
+        }
+
+        int operator()(int a, nullopt_t, int c) const
+        {
+            return a + c == sum ? 1 : 0;
+        }
+
+        int operator()(nullopt_t, int b, int c) const
+        {
+            return b + c == sum ? 1 : 0;
+        }
+
+        int operator()(int a, int b, int c) const
+        {
+            return a + b + c == sum ? 1 : 0;
+        }
+    };
+
+    optional<int> a, b, c;
+
+    // every combination selects the matching table entry
+    REQUIRE(visit_masked(visitor{0}, a, b, c) == 1);
+
+    a = 1;
+    REQUIRE(visit_masked(visitor{1}, a, b, c) == 1);
+
+    b = 2;
+    REQUIRE(visit_masked(visitor{3}, a, b, c) == 1);
+
+    c = 4;
+    REQUIRE(visit_masked(visitor{7}, a, b, c) == 1);
+
+    a = type_safe::nullopt;
+    REQUIRE(visit_masked(visitor{6}, a, b, c) == 1);
+
+    b = type_safe::nullopt;
+    REQUIRE(visit_masked(visitor{4}, a, b, c) == 1);
+
+    // single optional
+    struct single_visitor
+    {
+        int operator()(nullopt_t) const
+        {
+            return -1;
+        }
+
+        int operator()(int i) const
+        {
+            return i;
+        }
+    };
+
+    optional<int> single;
+    REQUIRE(visit_masked(single_visitor{}, single) == -1);
+    single = 11;
+    REQUIRE(visit_masked(single_visitor{}, single) == 11);
+}